@@ -0,0 +1,103 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "storage/index/b_plus_tree_index.hpp"
+#include "storage/index/cracking_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+namespace {
+
+template <typename Functor>
+double measure_milliseconds(const Functor& functor) {
+  const auto begin = std::chrono::steady_clock::now();
+  functor();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// Returns whether the query is one of those whose latencies are printed, i.e., 1, 2, 5, 10, 20, 50, ...
+bool is_reported(const size_t query) {
+  auto decade = size_t{1};
+  while (decade * 10 <= query) {
+    decade *= 10;
+  }
+  return query == decade || query == 2 * decade || query == 5 * decade;
+}
+
+}  // namespace
+
+// Runs a sequence of random range queries on a column of random integers and prints the latency of individual queries
+// for a full scan, a CrackingIndex, and a BPlusTreeIndex that is built before the first query. The latency of the
+// cracking index starts at about that of a scan and approaches that of the B+-tree, without the time to build it. The
+// number of rows and of queries can be passed as arguments. Build in release mode for meaningful numbers.
+int main(int argc, char* argv[]) {
+  const auto row_count = argc > 1 ? std::stoul(argv[1]) : size_t{10'000'000};
+  const auto query_count = argc > 2 ? std::stoul(argv[2]) : size_t{1'000};
+  const auto max_value = int32_t{1'000'000'000};
+  std::cout << "Rows: " << row_count << ", queries: " << query_count << std::endl;
+
+  auto random_engine = std::mt19937_64{17};
+  auto value_distribution = std::uniform_int_distribution<int32_t>{0, max_value};
+  auto values = std::vector<int32_t>(row_count);
+  for (auto& value : values) {
+    value = value_distribution(random_engine);
+  }
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(std::move(values));
+
+  const auto cracking_index = CrackingIndex<int32_t>{segment};
+  auto b_plus_tree_index = std::shared_ptr<BPlusTreeIndex<int32_t>>{};
+  const auto build_milliseconds =
+      measure_milliseconds([&]() { b_plus_tree_index = std::make_shared<BPlusTreeIndex<int32_t>>(*segment); });
+  std::cout << "B+-tree build [ms]: " << std::fixed << std::setprecision(1) << build_milliseconds << std::endl;
+
+  std::cout << std::setw(8) << "Query" << std::setw(12) << "scan [ms]" << std::setw(16) << "cracking [ms]"
+            << std::setw(15) << "B+-tree [ms]" << std::endl;
+  auto scan_total = 0.0;
+  auto cracking_total = 0.0;
+  auto b_plus_tree_total = build_milliseconds;
+
+  // Each query selects about 1% of the rows.
+  auto min_distribution = std::uniform_int_distribution<int32_t>{0, max_value - max_value / 100};
+  for (auto query = size_t{1}; query <= query_count; ++query) {
+    const auto min = min_distribution(random_engine);
+    const auto max = min + max_value / 100;
+
+    auto scan_matches = PosList{};
+    const auto scan_milliseconds = measure_milliseconds([&]() {
+      segment_iterate<int32_t>(*segment, [&](const auto& position) {
+        if (position.value >= min && position.value <= max) {
+          scan_matches.emplace_back(RowID{ChunkID{0}, position.chunk_offset});
+        }
+      });
+    });
+
+    auto cracking_matches = PosList{};
+    const auto cracking_milliseconds =
+        measure_milliseconds([&]() { cracking_index.append_range_matches(min, max, ChunkID{0}, cracking_matches); });
+
+    auto b_plus_tree_matches = PosList{};
+    const auto b_plus_tree_milliseconds = measure_milliseconds(
+        [&]() { b_plus_tree_index->append_range_matches(min, max, ChunkID{0}, b_plus_tree_matches); });
+
+    Assert(scan_matches.size() == cracking_matches.size() && scan_matches.size() == b_plus_tree_matches.size(),
+           "All access paths have to find the same rows.");
+    scan_total += scan_milliseconds;
+    cracking_total += cracking_milliseconds;
+    b_plus_tree_total += b_plus_tree_milliseconds;
+
+    if (is_reported(query) || query == query_count) {
+      std::cout << std::setw(8) << query << std::setprecision(3) << std::setw(12) << scan_milliseconds << std::setw(16)
+                << cracking_milliseconds << std::setw(15) << b_plus_tree_milliseconds << std::endl;
+    }
+  }
+
+  std::cout << std::setw(8) << "total" << std::setprecision(1) << std::setw(12) << scan_total << std::setw(16)
+            << cracking_total << std::setw(15) << b_plus_tree_total << std::endl;
+  return 0;
+}
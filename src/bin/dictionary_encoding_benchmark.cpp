@@ -0,0 +1,100 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+namespace {
+
+// The previous construction of DictionarySegment: all values are inserted into a std::map, whose iteration order
+// assigns the value ids, and each row looks up its value id in the map again.
+template <typename T>
+size_t encode_with_map(const ValueSegment<T>& segment) {
+  const auto& values = segment.values();
+  auto unique_values = std::map<T, ValueID, std::less<>>{};
+  for (const auto& value : values) {
+    unique_values.emplace(value, ValueID{0});
+  }
+
+  auto next_value_id = ValueID{0};
+  for (auto& [value, value_id] : unique_values) {
+    value_id = next_value_id++;
+  }
+
+  auto attribute_vector = FixedWidthIntegerVector<uint32_t>(values.size());
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    attribute_vector.set(index, unique_values.find(values[index])->second);
+  }
+  return unique_values.size();
+}
+
+template <typename Functor>
+double measure_milliseconds(const Functor& functor) {
+  const auto begin = std::chrono::steady_clock::now();
+  functor();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+template <typename T>
+void run_benchmark(const std::string& name, const std::shared_ptr<ValueSegment<T>>& segment) {
+  auto map_distinct_count = size_t{0};
+  const auto map_milliseconds = measure_milliseconds([&]() { map_distinct_count = encode_with_map(*segment); });
+
+  auto sorted_distinct_count = ChunkOffset{0};
+  const auto sorted_milliseconds = measure_milliseconds([&]() {
+    const auto dictionary_segment = DictionarySegment<T>{segment};
+    sorted_distinct_count = dictionary_segment.unique_values_count();
+  });
+  Assert(map_distinct_count == sorted_distinct_count, "Both constructions have to find the same distinct values.");
+
+  std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(1) << std::setw(12)
+            << map_milliseconds << std::setw(12) << sorted_milliseconds << std::setw(9) << std::setprecision(2)
+            << map_milliseconds / sorted_milliseconds << "x" << std::endl;
+}
+
+}  // namespace
+
+// Compares the construction time of DictionarySegments to the previous std::map-based construction. The number of rows
+// per segment can be passed as the first argument. Build in release mode for meaningful numbers.
+int main(int argc, char* argv[]) {
+  const auto row_count = argc > 1 ? std::stoul(argv[1]) : size_t{10'000'000};
+  std::cout << "Rows per segment: " << row_count << std::endl;
+  std::cout << std::left << std::setw(28) << "Segment" << std::right << std::setw(12) << "map [ms]" << std::setw(12)
+            << "sort [ms]" << std::setw(10) << "speedup" << std::endl;
+
+  auto random_engine = std::mt19937_64{17};
+  for (const auto distinct_count : {int64_t{100}, int64_t{10'000}, int64_t{1'000'000}}) {
+    auto distribution = std::uniform_int_distribution<int64_t>{0, distinct_count - 1};
+
+    auto int_values = std::vector<int32_t>(row_count);
+    for (auto& value : int_values) {
+      value = static_cast<int32_t>(distribution(random_engine));
+    }
+    run_benchmark("int, " + std::to_string(distinct_count) + " distinct",
+                  std::make_shared<ValueSegment<int32_t>>(std::move(int_values)));
+
+    auto long_values = std::vector<int64_t>(row_count);
+    for (auto& value : long_values) {
+      value = distribution(random_engine) * 1'000'003 - 500'000'000;
+    }
+    run_benchmark("long, " + std::to_string(distinct_count) + " distinct",
+                  std::make_shared<ValueSegment<int64_t>>(std::move(long_values)));
+
+    auto string_values = std::vector<std::string>(row_count);
+    for (auto& value : string_values) {
+      value = "customer#" + std::to_string(distribution(random_engine));
+    }
+    run_benchmark("string, " + std::to_string(distinct_count) + " distinct",
+                  std::make_shared<ValueSegment<std::string>>(std::move(string_values)));
+  }
+
+  return 0;
+}
@@ -0,0 +1,44 @@
+#include "all_type_variant.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <boost/hana/for_each.hpp>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// The type strings in the order of DataType.
+const auto& type_strings() {
+  static const auto strings = [] {
+    auto result = std::array<std::string, decltype(hana::length(types))::value>{};
+    auto index = size_t{0};
+    hana::for_each(data_types, [&](const auto data_type_pair) { result[index++] = hana::first(data_type_pair); });
+    return result;
+  }();
+  return strings;
+}
+
+}  // namespace
+
+namespace opossum {
+
+DataType data_type_from_string(const std::string& type_string) {
+  const auto& strings = type_strings();
+  const auto iterator = std::find(strings.begin(), strings.end(), type_string);
+  Assert(iterator != strings.end(), "Unknown data type " + type_string + ".");
+  return static_cast<DataType>(std::distance(strings.begin(), iterator));
+}
+
+const std::string& data_type_to_string(const DataType data_type) {
+  return type_strings().at(static_cast<size_t>(data_type));
+}
+
+std::ostream& operator<<(std::ostream& stream, const DataType data_type) {
+  return stream << data_type_to_string(data_type);
+}
+
+}  // namespace opossum
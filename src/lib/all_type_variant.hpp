@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <boost/hana/length.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
@@ -14,6 +15,8 @@
 #include <boost/preprocessor/seq/for_each.hpp>
 #include <boost/preprocessor/seq/transform.hpp>
 
+#include "date_time_types.hpp"
+#include "decimal.hpp"
 #include "null_value.hpp"
 #include "types.hpp"
 
@@ -25,9 +28,12 @@ namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
 
+// New types are appended, so that the indices of the existing types in AllTypeVariant do not change.
 // clang-format off
-#define data_types_macro                              (int32_t) (int64_t) (float)  (double)  (std::string)    // NOLINT
-static constexpr auto type_strings = hana::make_tuple("int",    "long",   "float", "double", "string"     );  // NOLINT
+#define data_types_macro                                                                                         \
+  (int32_t) (int64_t) (float)  (double)  (std::string) (int8_t) (int16_t) (Date)  (Timestamp)  (Decimal)    // NOLINT
+static constexpr auto type_strings = hana::make_tuple(
+  "int",    "long",   "float", "double", "string",     "int8",  "int16",  "date", "timestamp", "decimal");  // NOLINT
 // clang-format on
 
 // Extends to hana::make_tuple(hana::type_c<int32_t>, hana::type_c<int64_t>, ...);
@@ -69,6 +75,22 @@ static constexpr auto types = detail::types;
 static constexpr auto types_including_null = detail::types_including_null;
 static constexpr auto data_types = detail::data_types;
 
+// Identifies a data type at runtime, e.g., in the schema of a table. The enumerators follow the order of
+// data_types_macro, so that the value of a DataType is the index of its type in `types`. Type strings such as "int"
+// are only meant for the edges of the system (e.g., load_table) and are converted with data_type_from_string().
+enum class DataType : uint8_t { Int, Long, Float, Double, String, Int8, Int16, Date, Timestamp, Decimal };
+
+static_assert(static_cast<size_t>(DataType::Decimal) + 1 == decltype(hana::length(types))::value,
+              "DataType has to list all types of data_types_macro.");
+
+// Returns the DataType of a type string (e.g., "int"). Fails for unknown type strings.
+DataType data_type_from_string(const std::string& type_string);
+
+// Returns the type string of a DataType.
+const std::string& data_type_to_string(const DataType data_type);
+
+std::ostream& operator<<(std::ostream& stream, const DataType data_type);
+
 using AllTypeVariant = detail::AllTypeVariant;
 
 // Function to check if AllTypeVariant is NULL.
@@ -0,0 +1,168 @@
+#include "date_time_types.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Reads exactly digit_count decimal digits. Returns false if the stream holds anything else.
+bool read_digits(std::istream& stream, const int digit_count, int64_t& value) {
+  value = 0;
+  for (auto index = 0; index < digit_count; ++index) {
+    const auto character = stream.peek();
+    if (character < '0' || character > '9') {
+      return false;
+    }
+    value = value * 10 + (stream.get() - '0');
+  }
+  return true;
+}
+
+bool read_character(std::istream& stream, const char expected) {
+  if (stream.peek() != expected) {
+    return false;
+  }
+  stream.get();
+  return true;
+}
+
+// Parses YYYY-MM-DD without skipping whitespace.
+bool read_date(std::istream& stream, Date& date) {
+  auto year = int64_t{0};
+  auto month = int64_t{0};
+  auto day = int64_t{0};
+  if (!read_digits(stream, 4, year) || !read_character(stream, '-') || !read_digits(stream, 2, month) ||
+      !read_character(stream, '-') || !read_digits(stream, 2, day)) {
+    return false;
+  }
+
+  const auto year_month_day = std::chrono::year_month_day{
+      std::chrono::year{static_cast<int>(year)}, std::chrono::month{static_cast<unsigned>(month)},
+      std::chrono::day{static_cast<unsigned>(day)}};
+  if (!year_month_day.ok()) {
+    return false;
+  }
+  date = Date{static_cast<int32_t>(std::chrono::sys_days{year_month_day}.time_since_epoch().count())};
+  return true;
+}
+
+// Divides and rounds towards negative infinity, so that times before 1970 belong to the preceding day.
+int64_t floor_divide(const int64_t dividend, const int64_t divisor) {
+  const auto quotient = dividend / divisor;
+  return (dividend % divisor < 0) ? quotient - 1 : quotient;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Date Date::from_year_month_day(const int32_t year, const uint32_t month, const uint32_t day) {
+  const auto year_month_day =
+      std::chrono::year_month_day{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+  Assert(year_month_day.ok(), "Invalid date " + std::to_string(year) + "-" + std::to_string(month) + "-" +
+                                  std::to_string(day) + ".");
+  return Date{static_cast<int32_t>(std::chrono::sys_days{year_month_day}.time_since_epoch().count())};
+}
+
+Timestamp Timestamp::from_date(const Date date) {
+  return Timestamp{date.days_since_epoch() * MICROSECONDS_PER_DAY};
+}
+
+Date Timestamp::date() const {
+  return Date{static_cast<int32_t>(floor_divide(_microseconds_since_epoch, MICROSECONDS_PER_DAY))};
+}
+
+std::ostream& operator<<(std::ostream& stream, const Date& date) {
+  const auto year_month_day = std::chrono::year_month_day{std::chrono::sys_days{std::chrono::days{
+      date.days_since_epoch()}}};
+  char buffer[16];
+  std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", static_cast<int>(year_month_day.year()),
+                static_cast<unsigned>(year_month_day.month()), static_cast<unsigned>(year_month_day.day()));
+  return stream << buffer;
+}
+
+std::ostream& operator<<(std::ostream& stream, const Timestamp& timestamp) {
+  const auto microseconds = timestamp.microseconds_since_epoch();
+  const auto microseconds_of_day = microseconds - floor_divide(microseconds, Timestamp::MICROSECONDS_PER_DAY) *
+                                                      Timestamp::MICROSECONDS_PER_DAY;
+  const auto seconds_of_day = microseconds_of_day / Timestamp::MICROSECONDS_PER_SECOND;
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), " %02d:%02d:%02d", static_cast<int>(seconds_of_day / 3600),
+                static_cast<int>(seconds_of_day / 60 % 60), static_cast<int>(seconds_of_day % 60));
+  stream << timestamp.date() << buffer;
+
+  auto fraction = microseconds_of_day % Timestamp::MICROSECONDS_PER_SECOND;
+  if (fraction != 0) {
+    auto digit_count = 6;
+    while (fraction % 10 == 0) {
+      fraction /= 10;
+      --digit_count;
+    }
+    std::snprintf(buffer, sizeof(buffer), ".%0*d", digit_count, static_cast<int>(fraction));
+    stream << buffer;
+  }
+  return stream;
+}
+
+std::istream& operator>>(std::istream& stream, Date& date) {
+  const auto sentry = std::istream::sentry{stream};
+  if (sentry && !read_date(stream, date)) {
+    stream.setstate(std::ios::failbit);
+  }
+  return stream;
+}
+
+std::istream& operator>>(std::istream& stream, Timestamp& timestamp) {
+  const auto sentry = std::istream::sentry{stream};
+  if (!sentry) {
+    return stream;
+  }
+
+  auto date = Date{};
+  if (!read_date(stream, date)) {
+    stream.setstate(std::ios::failbit);
+    return stream;
+  }
+  timestamp = Timestamp::from_date(date);
+  // Peeking again after reaching the end of the stream would set the failbit.
+  const auto separator = stream.peek();
+  if (separator != ' ' && separator != 'T') {
+    return stream;
+  }
+  stream.get();
+
+  auto hours = int64_t{0};
+  auto minutes = int64_t{0};
+  auto seconds = int64_t{0};
+  if (!read_digits(stream, 2, hours) || !read_character(stream, ':') || !read_digits(stream, 2, minutes) ||
+      !read_character(stream, ':') || !read_digits(stream, 2, seconds) || hours > 23 || minutes > 59 ||
+      seconds > 59) {
+    stream.setstate(std::ios::failbit);
+    return stream;
+  }
+
+  auto microseconds = int64_t{0};
+  if (read_character(stream, '.')) {
+    auto digit_count = 0;
+    for (auto digit = int64_t{0}; digit_count < 6 && read_digits(stream, 1, digit); ++digit_count) {
+      microseconds = microseconds * 10 + digit;
+    }
+    if (digit_count == 0) {
+      stream.setstate(std::ios::failbit);
+      return stream;
+    }
+    for (; digit_count < 6; ++digit_count) {
+      microseconds *= 10;
+    }
+  }
+
+  timestamp = Timestamp{timestamp.microseconds_since_epoch() +
+                        (hours * 3600 + minutes * 60 + seconds) * Timestamp::MICROSECONDS_PER_SECOND + microseconds};
+  return stream;
+}
+
+}  // namespace opossum
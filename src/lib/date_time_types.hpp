@@ -0,0 +1,84 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+
+namespace opossum {
+
+// Date represents a calendar day as the number of days since 1970-01-01 (negative for earlier days). Compared to
+// storing dates as strings, it needs four bytes and compares as an integer. It is read and printed as YYYY-MM-DD.
+class Date {
+ public:
+  constexpr Date() = default;
+  constexpr explicit Date(const int32_t days_since_epoch) : _days_since_epoch{days_since_epoch} {}
+
+  // Creates a date from its year, month (1-12), and day (1-31). Fails for days that do not exist.
+  static Date from_year_month_day(const int32_t year, const uint32_t month, const uint32_t day);
+
+  constexpr int32_t days_since_epoch() const {
+    return _days_since_epoch;
+  }
+
+  friend constexpr auto operator<=>(const Date& lhs, const Date& rhs) = default;
+
+ protected:
+  int32_t _days_since_epoch{0};
+};
+
+// Timestamp represents a point in time as the number of microseconds since 1970-01-01 00:00:00, without a time zone.
+// It is read as YYYY-MM-DD[( |T)HH:MM:SS[.ffffff]] and printed as YYYY-MM-DD HH:MM:SS, followed by the fraction of a
+// second if it is not zero.
+class Timestamp {
+ public:
+  static constexpr auto MICROSECONDS_PER_SECOND = int64_t{1'000'000};
+  static constexpr auto MICROSECONDS_PER_DAY = 86'400 * MICROSECONDS_PER_SECOND;
+
+  constexpr Timestamp() = default;
+  constexpr explicit Timestamp(const int64_t microseconds_since_epoch)
+      : _microseconds_since_epoch{microseconds_since_epoch} {}
+
+  // Returns the timestamp at the beginning of a day.
+  static Timestamp from_date(const Date date);
+
+  constexpr int64_t microseconds_since_epoch() const {
+    return _microseconds_since_epoch;
+  }
+
+  // Returns the day the timestamp belongs to.
+  Date date() const;
+
+  friend constexpr auto operator<=>(const Timestamp& lhs, const Timestamp& rhs) = default;
+
+ protected:
+  int64_t _microseconds_since_epoch{0};
+};
+
+std::ostream& operator<<(std::ostream& stream, const Date& date);
+std::ostream& operator<<(std::ostream& stream, const Timestamp& timestamp);
+
+// Parsing errors set the failbit of the stream, so that boost::lexical_cast throws a bad_lexical_cast.
+std::istream& operator>>(std::istream& stream, Date& date);
+std::istream& operator>>(std::istream& stream, Timestamp& timestamp);
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::Date> {
+  size_t operator()(const opossum::Date& date) const {
+    return hash<int32_t>{}(date.days_since_epoch());
+  }
+};
+
+template <>
+struct hash<opossum::Timestamp> {
+  size_t operator()(const opossum::Timestamp& timestamp) const {
+    return hash<int64_t>{}(timestamp.microseconds_since_epoch());
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,99 @@
+#include "decimal.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+namespace opossum {
+
+double Decimal::to_double() const {
+  return static_cast<double>(_unscaled_value) / SCALE_FACTOR;
+}
+
+std::ostream& operator<<(std::ostream& stream, const Decimal& decimal) {
+  const auto unscaled_value = decimal.unscaled_value();
+  // The magnitude is computed unsigned, as negating the smallest int64_t overflows.
+  const auto magnitude =
+      unscaled_value < 0 ? uint64_t{0} - static_cast<uint64_t>(unscaled_value) : static_cast<uint64_t>(unscaled_value);
+  if (unscaled_value < 0) {
+    stream << '-';
+  }
+  stream << magnitude / Decimal::SCALE_FACTOR;
+
+  // Trailing zeros of the decimal places are omitted.
+  auto fraction = magnitude % Decimal::SCALE_FACTOR;
+  if (fraction != 0) {
+    auto digit_count = Decimal::SCALE;
+    while (fraction % 10 == 0) {
+      fraction /= 10;
+      --digit_count;
+    }
+    char buffer[8];
+    std::snprintf(buffer, sizeof(buffer), ".%0*d", digit_count, static_cast<int>(fraction));
+    stream << buffer;
+  }
+  return stream;
+}
+
+std::istream& operator>>(std::istream& stream, Decimal& decimal) {
+  const auto sentry = std::istream::sentry{stream};
+  if (!sentry) {
+    return stream;
+  }
+
+  const auto is_negative = stream.peek() == '-';
+  if (is_negative || stream.peek() == '+') {
+    stream.get();
+  }
+
+  // The value is accumulated negatively, as the range of negative int64_t values is larger by one.
+  constexpr auto MIN_VALUE = std::numeric_limits<int64_t>::min();
+  auto value = int64_t{0};
+  auto digit_count = 0;
+  auto decimal_place_count = -1;
+  while (true) {
+    const auto character = stream.peek();
+    if (character == '.' && decimal_place_count < 0) {
+      stream.get();
+      decimal_place_count = 0;
+      continue;
+    }
+    if (character < '0' || character > '9') {
+      break;
+    }
+
+    const auto digit = stream.get() - '0';
+    if (decimal_place_count >= 0 && ++decimal_place_count > Decimal::SCALE) {
+      stream.setstate(std::ios::failbit);
+      return stream;
+    }
+    if (value < (MIN_VALUE + digit) / 10) {
+      stream.setstate(std::ios::failbit);
+      return stream;
+    }
+    value = value * 10 - digit;
+    ++digit_count;
+  }
+
+  if (digit_count == 0) {
+    stream.setstate(std::ios::failbit);
+    return stream;
+  }
+
+  for (auto place = std::max(decimal_place_count, 0); place < Decimal::SCALE; ++place) {
+    if (value < MIN_VALUE / 10) {
+      stream.setstate(std::ios::failbit);
+      return stream;
+    }
+    value *= 10;
+  }
+
+  if (!is_negative && value == MIN_VALUE) {
+    stream.setstate(std::ios::failbit);
+    return stream;
+  }
+  decimal = Decimal::from_unscaled(is_negative ? value : -value);
+  return stream;
+}
+
+}  // namespace opossum
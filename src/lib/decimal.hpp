@@ -0,0 +1,55 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+
+namespace opossum {
+
+// Decimal is a fixed-point number with SCALE decimal places, stored as an integer multiple of 10^-SCALE. Unlike
+// double, it represents values such as 0.1 exactly, so sums of prices do not accumulate rounding errors. It is read
+// from and printed as a decimal number (e.g., -12.5). Reading a value with more than SCALE decimal places fails.
+class Decimal {
+ public:
+  static constexpr auto SCALE = 4;
+  static constexpr auto SCALE_FACTOR = int64_t{10'000};
+
+  constexpr Decimal() = default;
+
+  // Creates a decimal from its unscaled value, i.e., Decimal::from_unscaled(125) is 0.0125.
+  static constexpr Decimal from_unscaled(const int64_t unscaled_value) {
+    auto decimal = Decimal{};
+    decimal._unscaled_value = unscaled_value;
+    return decimal;
+  }
+
+  constexpr int64_t unscaled_value() const {
+    return _unscaled_value;
+  }
+
+  double to_double() const;
+
+  friend constexpr auto operator<=>(const Decimal& lhs, const Decimal& rhs) = default;
+
+ protected:
+  int64_t _unscaled_value{0};
+};
+
+std::ostream& operator<<(std::ostream& stream, const Decimal& decimal);
+
+// Parsing errors set the failbit of the stream, so that boost::lexical_cast throws a bad_lexical_cast.
+std::istream& operator>>(std::istream& stream, Decimal& decimal);
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::Decimal> {
+  size_t operator()(const opossum::Decimal& decimal) const {
+    return hash<int64_t>{}(decimal.unscaled_value());
+  }
+};
+
+}  // namespace std
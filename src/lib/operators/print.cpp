@@ -68,7 +68,8 @@ std::shared_ptr<const Table> Print::_on_execute() {
       for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
         // Yes, we use AbstractSegment::operator[] here, but since Print is not an operation that should be part of a
         // regular query plan, let's keep things simple here.
-        _out << std::setw(widths[column_id]) << (*chunk->get_segment(column_id))[row] << "|" << std::setw(0);
+        const auto value = type_cast<std::string>((*chunk->get_segment(column_id))[row]);
+        _out << std::setw(widths[column_id]) << value << "|" << std::setw(0);
       }
 
       _out << std::endl;
@@ -99,7 +100,7 @@ std::vector<uint16_t> Print::_column_string_widths(uint16_t min, uint16_t max,
     for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
       for (auto row = size_t{0}; row < chunk->size(); ++row) {
         auto cell_length =
-            static_cast<uint16_t>(boost::lexical_cast<std::string>((*chunk->get_segment(column_id))[row]).size());
+            static_cast<uint16_t>(type_cast<std::string>((*chunk->get_segment(column_id))[row]).size());
         widths[column_id] = std::max({min, widths[column_id], std::min(max, cell_length)});
       }
     }
@@ -1,22 +1,27 @@
 #pragma once
 
-#include <boost/hana/equal.hpp>
-#include <boost/hana/for_each.hpp>
 #include <boost/hana/size.hpp>
+#include <boost/preprocessor/seq/for_each_i.hpp>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 namespace hana = boost::hana;
 
+// Expands to one case per type in data_types_macro, e.g., case static_cast<DataType>(0): func(hana::type_c<int32_t>);
+#define RESOLVE_DATA_TYPE_CASE(r, func, index, type) \
+  case static_cast<DataType>(index):                 \
+    func(hana::type_c<type>);                        \
+    return;
+
 /**
- * Resolves a type string by passing a hana::type object on to a generic lambda
+ * Resolves a DataType by passing a hana::type object on to a generic lambda
  *
- * @param type_string is a string representation of any of the supported data types
+ * @param data_type is any of the supported data types
  * @param func is a generic lambda or similar accepting a hana::type object
  *
- *
  * Note on hana::type (taken from Boost.Hana documentation):
  *
  * For subtle reasons having to do with ADL, the actual representation of hana::type is
@@ -51,7 +56,7 @@ namespace hana = boost::hana;
  *   template <typename T>
  *   process_type(hana::basic_type<T> type);  // note: parameter type needs to be hana::basic_type not hana::type!
  *
- *   resolve_data_type(type_string, [&](auto type) {
+ *   resolve_data_type(data_type, [&](auto type) {
  *     using Type = typename decltype(type)::type;
  *     const auto var = type_cast<Type>(variant_from_elsewhere);
  *     process_variant(var);
@@ -60,14 +65,18 @@ namespace hana = boost::hana;
  *   });
  */
 template <typename Functor>
+void resolve_data_type(const DataType data_type, const Functor& func) {
+  switch (data_type) { BOOST_PP_SEQ_FOR_EACH_I(RESOLVE_DATA_TYPE_CASE, func, data_types_macro) }
+  Fail("Unknown data type.");
+}
+
+#undef RESOLVE_DATA_TYPE_CASE
+
+// Same as resolve_data_type(DataType, ...), but for a type string (e.g., "int"). Prefer converting the string once with
+// data_type_from_string() over calling this for every value.
+template <typename Functor>
 void resolve_data_type(const std::string& type_string, const Functor& func) {
-  hana::for_each(data_types, [&](auto x) {
-    if (std::string(hana::first(x)) == type_string) {
-      // The + before hana::second - which returns a reference - converts its return value into a value
-      func(+hana::second(x));
-      return;
-    }
-  });
+  resolve_data_type(data_type_from_string(type_string), func);
 }
 
 }  // namespace opossum
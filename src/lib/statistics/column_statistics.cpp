@@ -0,0 +1,82 @@
+#include "column_statistics.hpp"
+
+#include <algorithm>
+
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+uint64_t BaseColumnStatistics::row_count() const {
+  return _row_count;
+}
+
+uint64_t BaseColumnStatistics::null_count() const {
+  return _null_count;
+}
+
+double BaseColumnStatistics::null_fraction() const {
+  return _row_count == 0 ? 0.0 : static_cast<double>(_null_count) / static_cast<double>(_row_count);
+}
+
+double BaseColumnStatistics::distinct_count() const {
+  // The sketch may estimate more distinct values than there are values.
+  return std::min(_distinct_values.estimate(), static_cast<double>(_row_count - _null_count));
+}
+
+double BaseColumnStatistics::average_string_length() const {
+  const auto value_count = _row_count - _null_count;
+  return value_count == 0 ? 0.0 : static_cast<double>(_string_length_sum) / static_cast<double>(value_count);
+}
+
+template <typename T>
+ColumnStatistics<T>::ColumnStatistics(const AbstractSegment& segment) {
+  _row_count = segment.size();
+  auto values = std::vector<T>{};
+  values.reserve(segment.size());
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null) {
+      ++_null_count;
+      return;
+    }
+    _distinct_values.insert(position.value);
+    if constexpr (std::is_same_v<T, std::string>) {
+      _string_length_sum += position.value.size();
+    }
+    values.emplace_back(position.value);
+  });
+  std::sort(values.begin(), values.end());
+  _histogram = EquiDepthHistogram<T>{values};
+}
+
+template <typename T>
+ColumnStatistics<T>::ColumnStatistics(
+    const std::vector<std::shared_ptr<const ColumnStatistics<T>>>& segment_statistics) {
+  auto histograms = std::vector<const EquiDepthHistogram<T>*>{};
+  histograms.reserve(segment_statistics.size());
+  for (const auto& statistics : segment_statistics) {
+    _row_count += statistics->_row_count;
+    _null_count += statistics->_null_count;
+    _string_length_sum += statistics->_string_length_sum;
+    _distinct_values.merge(statistics->_distinct_values);
+    histograms.push_back(&statistics->_histogram);
+  }
+  _histogram = EquiDepthHistogram<T>{histograms, distinct_count()};
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  if (_row_count == 0 || variant_is_null(search_value)) {
+    return 0.0;
+  }
+  return _histogram.estimate_count(scan_type, type_cast<T>(search_value)) / static_cast<double>(_row_count);
+}
+
+template <typename T>
+const EquiDepthHistogram<T>& ColumnStatistics<T>::histogram() const {
+  return _histogram;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatistics);
+
+}  // namespace opossum
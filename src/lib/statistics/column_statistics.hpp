@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "equi_depth_histogram.hpp"
+#include "hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// BaseColumnStatistics is the base class of all ColumnStatistics. It holds the statistics that do not depend on the
+// data type and allows to estimate selectivities without resolving the data type first.
+class BaseColumnStatistics : private Noncopyable {
+ public:
+  virtual ~BaseColumnStatistics() = default;
+
+  // Returns the number of rows, including NULLs.
+  uint64_t row_count() const;
+
+  // Returns the number of NULLs.
+  uint64_t null_count() const;
+
+  // Returns the share of rows that are NULL, or 0 if there are no rows.
+  double null_fraction() const;
+
+  // Returns the estimated number of distinct values, not counting NULL.
+  double distinct_count() const;
+
+  // Returns the average length of the values that are not NULL. This is 0 for columns that do not store strings.
+  double average_string_length() const;
+
+  // Returns the estimated share of rows that satisfy `value <scan_type> search_value`. Comparisons with NULL are never
+  // true, so NULL rows and NULL search values do not match. Search values of another data type are converted.
+  virtual double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+ protected:
+  uint64_t _row_count{0};
+  uint64_t _null_count{0};
+  uint64_t _string_length_sum{0};
+  HyperLogLog _distinct_values;
+};
+
+// ColumnStatistics describes the values of a segment, or of a whole column after the statistics of its segments are
+// merged. Both the histogram and the distinct-count sketch can be merged, so that the statistics of a table are
+// refreshed by recomputing the statistics of a single chunk.
+template <typename T>
+class ColumnStatistics : public BaseColumnStatistics {
+ public:
+  // Creates the statistics of a segment, which may use any encoding.
+  explicit ColumnStatistics(const AbstractSegment& segment);
+
+  // Merges the statistics of several segments of a column.
+  explicit ColumnStatistics(const std::vector<std::shared_ptr<const ColumnStatistics<T>>>& segment_statistics);
+
+  double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  const EquiDepthHistogram<T>& histogram() const;
+
+ protected:
+  EquiDepthHistogram<T> _histogram;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ColumnStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,246 @@
+#include "equi_depth_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Returns the share of the values of a bin that are smaller than the search value, which lies in (min, max]. Values
+// are assumed to be distributed uniformly between min and max. Types without a numeric distance, i.e., strings, are
+// assumed to have half of the values of the bin below the search value.
+template <typename T>
+double share_of_smaller_values(const T& min, const T& max, const T& search_value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return (static_cast<double>(search_value) - static_cast<double>(min)) /
+           (static_cast<double>(max) - static_cast<double>(min));
+  } else if constexpr (std::is_integral_v<T>) {
+    // Integers are discrete, so a bin [min, max] holds max - min + 1 different values.
+    return (static_cast<double>(search_value) - static_cast<double>(min)) /
+           (static_cast<double>(max) - static_cast<double>(min) + 1.0);
+  } else if constexpr (std::is_same_v<T, Date>) {
+    return share_of_smaller_values(min.days_since_epoch(), max.days_since_epoch(), search_value.days_since_epoch());
+  } else if constexpr (std::is_same_v<T, Timestamp>) {
+    return share_of_smaller_values(min.microseconds_since_epoch(), max.microseconds_since_epoch(),
+                                   search_value.microseconds_since_epoch());
+  } else if constexpr (std::is_same_v<T, Decimal>) {
+    return share_of_smaller_values(min.unscaled_value(), max.unscaled_value(), search_value.unscaled_value());
+  } else {
+    return 0.5;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+EquiDepthHistogram<T>::EquiDepthHistogram(const std::vector<T>& sorted_values) : _total_count(sorted_values.size()) {
+  const auto target_height = (sorted_values.size() + MAX_BIN_COUNT - 1) / MAX_BIN_COUNT;
+  auto index = size_t{0};
+  while (index < sorted_values.size()) {
+    auto bin = Bin{sorted_values[index], sorted_values[index], 0, 0};
+    // Adds all occurrences of one value at a time, until the bin is high enough. A value that would fill a bin on its
+    // own starts a new bin, so that its frequency is not averaged with the values before it.
+    while (index < sorted_values.size() && bin.height < target_height) {
+      const auto value_end =
+          std::upper_bound(sorted_values.begin() + static_cast<std::ptrdiff_t>(index), sorted_values.end(),
+                           sorted_values[index]) -
+          sorted_values.begin();
+      if (bin.height > 0 && static_cast<size_t>(value_end) - index >= target_height) {
+        break;
+      }
+      bin.max = sorted_values[index];
+      bin.height += static_cast<uint64_t>(value_end) - index;
+      ++bin.distinct_count;
+      index = static_cast<size_t>(value_end);
+    }
+    _bins.push_back(std::move(bin));
+  }
+}
+
+template <typename T>
+EquiDepthHistogram<T>::EquiDepthHistogram(const std::vector<const EquiDepthHistogram<T>*>& histograms,
+                                          const double distinct_count) {
+  auto bins = std::vector<Bin>{};
+  for (const auto* histogram : histograms) {
+    bins.insert(bins.end(), histogram->_bins.begin(), histogram->_bins.end());
+    _total_count += histogram->_total_count;
+  }
+  if (bins.empty()) {
+    return;
+  }
+
+  // The bounds of all bins split the range of values into pieces: piece 2k is the point edges[k], and piece 2k + 1 is
+  // the open interval between edges[k] and edges[k + 1].
+  auto edges = std::vector<T>{};
+  edges.reserve(2 * bins.size());
+  for (const auto& bin : bins) {
+    edges.push_back(bin.min);
+    edges.push_back(bin.max);
+  }
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end(),
+                          [](const auto& lhs, const auto& rhs) { return !(lhs < rhs) && !(rhs < lhs); }),
+              edges.end());
+  const auto edge_index = [&](const T& value) {
+    return static_cast<size_t>(std::lower_bound(edges.begin(), edges.end(), value) - edges.begin());
+  };
+
+  // Each bin adds its values to the pieces it covers. Its minimum and its maximum are values of the bin with the
+  // average frequency. The other values are spread over the intervals in between by their share of the range.
+  const auto piece_count = 2 * edges.size() - 1;
+  auto piece_heights = std::vector<double>(piece_count);
+  auto piece_distinct_counts = std::vector<double>(piece_count);
+  auto summed_distinct_count = uint64_t{0};
+  for (const auto& bin : bins) {
+    summed_distinct_count += bin.distinct_count;
+    const auto first_edge = edge_index(bin.min);
+    const auto last_edge = edge_index(bin.max);
+    const auto height = static_cast<double>(bin.height);
+    const auto bin_distinct_count = static_cast<double>(bin.distinct_count);
+    if (first_edge == last_edge) {
+      piece_heights[2 * first_edge] += height;
+      piece_distinct_counts[2 * first_edge] += bin_distinct_count;
+      continue;
+    }
+
+    const auto bound_height = height / std::max(bin_distinct_count, 2.0);
+    const auto bound_distinct_count = std::min(bin_distinct_count, 2.0) / 2;
+    for (const auto edge : {first_edge, last_edge}) {
+      piece_heights[2 * edge] += bound_height;
+      piece_distinct_counts[2 * edge] += bound_distinct_count;
+    }
+
+    const auto inner_height = height - 2 * bound_height;
+    const auto inner_distinct_count = bin_distinct_count - 2 * bound_distinct_count;
+    const auto range_share = share_of_smaller_values(bin.min, bin.max, bin.max);
+    auto previous_share = 0.0;
+    for (auto edge = first_edge + 1; edge <= last_edge; ++edge) {
+      const auto share = edge == last_edge ? 1.0 : share_of_smaller_values(bin.min, bin.max, edges[edge]) / range_share;
+      piece_heights[2 * edge - 1] += inner_height * (share - previous_share);
+      piece_distinct_counts[2 * edge - 1] += inner_distinct_count * (share - previous_share);
+      previous_share = share;
+    }
+  }
+
+  // The pieces are grouped into bins of about equal height again. Bins only end at points, so that the values of a
+  // frequent point stay in one bin. A bin that begins with an interval starts at the point before it, which thus bounds
+  // two bins. Equality estimates for this point include both bins, but each bin adds only the average frequency.
+  const auto distinct_scale = std::min(distinct_count / static_cast<double>(summed_distinct_count), 1.0);
+  const auto target_height = std::max(static_cast<double>(_total_count) / MAX_BIN_COUNT, 1.0);
+  auto bin = std::optional<Bin>{};
+  auto bin_height = 0.0;
+  auto bin_distinct_count = 0.0;
+  // The heights are rounded from the running sum, so that they add up to the number of values.
+  auto summed_height = 0.0;
+  auto rounded_summed_height = uint64_t{0};
+  const auto add_bin = [&]() {
+    const auto rounded_end = static_cast<uint64_t>(std::llround(summed_height));
+    bin->height = rounded_end - rounded_summed_height;
+    rounded_summed_height = rounded_end;
+    if (bin->height == 0 && !_bins.empty()) {
+      _bins.back().max = bin->max;
+      return;
+    }
+    // A bin holds at least one distinct value and at most one per value.
+    const auto scaled_distinct_count = static_cast<uint64_t>(bin_distinct_count * distinct_scale);
+    bin->distinct_count = std::clamp(scaled_distinct_count, uint64_t{1}, std::max(bin->height, uint64_t{1}));
+    _bins.push_back(std::move(*bin));
+  };
+
+  for (auto piece = size_t{0}; piece < piece_count; ++piece) {
+    if (!bin) {
+      // Intervals that no bin covers, i.e., the gaps between chunks with disjoint ranges, do not start a bin.
+      if (piece_heights[piece] <= 0.0) {
+        continue;
+      }
+      bin = Bin{edges[piece / 2], edges[piece / 2], 0, 0};
+      bin_height = 0.0;
+      bin_distinct_count = 0.0;
+    }
+    bin_height += piece_heights[piece];
+    bin_distinct_count += piece_distinct_counts[piece];
+    summed_height += piece_heights[piece];
+
+    const auto is_point = piece % 2 == 0;
+    if (is_point) {
+      bin->max = edges[piece / 2];
+      // The last bin takes all remaining values, so that there are at most MAX_BIN_COUNT bins.
+      if (bin_height >= target_height && _bins.size() + 1 < MAX_BIN_COUNT) {
+        add_bin();
+        bin.reset();
+      }
+    }
+  }
+  if (bin) {
+    add_bin();
+  }
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::estimate_count(const ScanType scan_type, const T& search_value) const {
+  const auto total_count = static_cast<double>(_total_count);
+  const auto equal_count = _estimate_equal_count(search_value);
+  const auto less_count = _estimate_less_count(search_value);
+  const auto estimate = [&]() {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return equal_count;
+      case ScanType::OpNotEquals:
+        return total_count - equal_count;
+      case ScanType::OpLessThan:
+        return less_count;
+      case ScanType::OpLessThanEquals:
+        return less_count + equal_count;
+      case ScanType::OpGreaterThan:
+        return total_count - less_count - equal_count;
+      case ScanType::OpGreaterThanEquals:
+        return total_count - less_count;
+    }
+    Fail("Unknown scan type.");
+  }();
+  return std::clamp(estimate, 0.0, total_count);
+}
+
+template <typename T>
+uint64_t EquiDepthHistogram<T>::total_count() const {
+  return _total_count;
+}
+
+template <typename T>
+const std::vector<typename EquiDepthHistogram<T>::Bin>& EquiDepthHistogram<T>::bins() const {
+  return _bins;
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::_estimate_equal_count(const T& search_value) const {
+  auto count = 0.0;
+  for (const auto& bin : _bins) {
+    if (!(search_value < bin.min) && !(bin.max < search_value)) {
+      count += static_cast<double>(bin.height) / static_cast<double>(bin.distinct_count);
+    }
+  }
+  return count;
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::_estimate_less_count(const T& search_value) const {
+  auto count = 0.0;
+  for (const auto& bin : _bins) {
+    if (bin.max < search_value) {
+      count += static_cast<double>(bin.height);
+    } else if (bin.min < search_value) {
+      count += static_cast<double>(bin.height) * share_of_smaller_values(bin.min, bin.max, search_value);
+    }
+  }
+  return count;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
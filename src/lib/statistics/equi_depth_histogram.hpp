@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// An EquiDepthHistogram describes the distribution of the values of a column with up to MAX_BIN_COUNT bins that hold
+// about the same number of values each. Thus, frequent values get narrow bins and are estimated more accurately than
+// with bins of equal width. Within a bin, the values are assumed to be distributed uniformly. A value is never split
+// across bins, so a very frequent value may fill a bin that is higher than the others.
+//
+// The histograms of the chunks of a table are merged by splitting their bins at the bounds of all bins and grouping
+// the pieces into bins of equal depth again. Thus, the merged histogram has about as many bins as the histograms of the
+// chunks, no matter how much the ranges of the chunks overlap.
+template <typename T>
+class EquiDepthHistogram {
+ public:
+  static constexpr auto MAX_BIN_COUNT = size_t{32};
+
+  struct Bin {
+    T min;
+    T max;
+    // The number of values in the bin.
+    uint64_t height;
+    uint64_t distinct_count;
+  };
+
+  // Creates a histogram without values.
+  EquiDepthHistogram() = default;
+
+  // Creates a histogram of values that are sorted in ascending order.
+  explicit EquiDepthHistogram(const std::vector<T>& sorted_values);
+
+  // Creates a histogram from the bins of other histograms. As the same value may occur in several of them, the distinct
+  // counts of the bins are scaled so that they add up to the given distinct count of all values.
+  EquiDepthHistogram(const std::vector<const EquiDepthHistogram<T>*>& histograms, const double distinct_count);
+
+  // Returns the estimated number of values that satisfy `value <scan_type> search_value`.
+  double estimate_count(const ScanType scan_type, const T& search_value) const;
+
+  // Returns the number of values.
+  uint64_t total_count() const;
+
+  const std::vector<Bin>& bins() const;
+
+ protected:
+  // Returns the estimated number of values that are equal to the search value.
+  double _estimate_equal_count(const T& search_value) const;
+
+  // Returns the estimated number of values that are smaller than the search value.
+  double _estimate_less_count(const T& search_value) const;
+
+  std::vector<Bin> _bins;
+  uint64_t _total_count{0};
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
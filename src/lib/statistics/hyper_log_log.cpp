@@ -0,0 +1,58 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog() : _registers(size_t{1} << PRECISION) {}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  for (auto index = size_t{0}; index < _registers.size(); ++index) {
+    _registers[index] = std::max(_registers[index], other._registers[index]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+  auto inverse_sum = 0.0;
+  auto empty_registers = size_t{0};
+  for (const auto value : _registers) {
+    inverse_sum += std::ldexp(1.0, -value);
+    empty_registers += value == 0;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For few distinct values, most registers are still empty and the raw estimate is biased. Counting the empty
+  // registers (linear counting) is more accurate then.
+  if (estimate <= 2.5 * register_count && empty_registers > 0) {
+    return register_count * std::log(register_count / static_cast<double>(empty_registers));
+  }
+  return estimate;
+}
+
+size_t HyperLogLog::estimate_memory_usage() const {
+  return sizeof(*this) + _registers.capacity();
+}
+
+void HyperLogLog::_insert_hash(const size_t hash) {
+  // std::hash maps integers to themselves. The finalizer of MurmurHash3 mixes all input bits into all output bits, so
+  // that both the register and the run of zeros are independent of patterns in the values.
+  auto mixed_hash = static_cast<uint64_t>(hash);
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= uint64_t{0xff51afd7ed558ccd};
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= uint64_t{0xc4ceb9fe1a85ec53};
+  mixed_hash ^= mixed_hash >> 33;
+
+  const auto index = static_cast<size_t>(mixed_hash >> (64 - PRECISION));
+  // The guard bit limits the run of zeros to the bits that are not used for the register index.
+  const auto remaining_bits = (mixed_hash << PRECISION) | (uint64_t{1} << (PRECISION - 1));
+  const auto rank = static_cast<uint8_t>(std::countl_zero(remaining_bits) + 1);
+  _registers[index] = std::max(_registers[index], rank);
+}
+
+}  // namespace opossum
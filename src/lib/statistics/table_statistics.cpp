@@ -0,0 +1,86 @@
+#include "table_statistics.hpp"
+
+#include "column_statistics.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+std::vector<DataType> column_data_types(const Table& table) {
+  auto data_types = std::vector<DataType>{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    data_types.push_back(table.column_data_type(column_id));
+  }
+  return data_types;
+}
+
+std::vector<TableStatistics::ChunkStatistics> generate_all_chunk_statistics(const Table& table) {
+  auto chunk_statistics = std::vector<TableStatistics::ChunkStatistics>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    chunk_statistics.push_back(TableStatistics::generate_chunk_statistics(table, chunk_id));
+  }
+  return chunk_statistics;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TableStatistics::TableStatistics(const Table& table)
+    : TableStatistics(column_data_types(table), generate_all_chunk_statistics(table)) {}
+
+TableStatistics::TableStatistics(const std::vector<DataType>& column_data_types,
+                                 std::vector<ChunkStatistics>&& chunk_statistics)
+    : _chunk_statistics(std::move(chunk_statistics)) {
+  const auto column_count = column_data_types.size();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(column_data_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto segment_statistics = std::vector<std::shared_ptr<const ColumnStatistics<ColumnDataType>>>{};
+      for (const auto& statistics : _chunk_statistics) {
+        if (statistics.empty()) {
+          continue;
+        }
+        DebugAssert(statistics.size() == column_count, "Chunk statistics do not match the columns.");
+        segment_statistics.push_back(
+            std::static_pointer_cast<const ColumnStatistics<ColumnDataType>>(statistics[column_id]));
+      }
+      _column_statistics.push_back(std::make_shared<ColumnStatistics<ColumnDataType>>(segment_statistics));
+    });
+  }
+}
+
+TableStatistics::ChunkStatistics TableStatistics::generate_chunk_statistics(const Table& table,
+                                                                            const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  auto chunk_statistics = ChunkStatistics{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      chunk_statistics.push_back(std::make_shared<ColumnStatistics<ColumnDataType>>(*chunk->get_segment(column_id)));
+    });
+  }
+  return chunk_statistics;
+}
+
+const std::vector<TableStatistics::ChunkStatistics>& TableStatistics::chunk_statistics() const {
+  return _chunk_statistics;
+}
+
+std::shared_ptr<const BaseColumnStatistics> TableStatistics::column_statistics(const ColumnID column_id) const {
+  return _column_statistics.at(column_id);
+}
+
+uint64_t TableStatistics::row_count() const {
+  // Each column describes all rows, so any of them can be asked.
+  return _column_statistics.empty() ? 0 : _column_statistics.front()->row_count();
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value) const {
+  return column_statistics(column_id)->estimate_selectivity(scan_type, search_value);
+}
+
+}  // namespace opossum
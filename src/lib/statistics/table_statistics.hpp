@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnStatistics;
+class Table;
+
+// TableStatistics describes the columns of a table, so that the cost of operators can be estimated before they are
+// executed, e.g., to run the most selective scan first. The statistics are kept per chunk and merged for each column.
+// A table refreshes its statistics whenever it compresses a chunk (see Table::generate_statistics). Only the
+// statistics of that chunk are recomputed, while those of the other chunks are merged again.
+class TableStatistics : private Noncopyable {
+ public:
+  // The statistics of each column of a chunk.
+  using ChunkStatistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>;
+
+  // Generates the statistics of all chunks of a table.
+  explicit TableStatistics(const Table& table);
+
+  // Merges the statistics of the chunks of a table with the given column data types. Chunks without statistics are
+  // given as empty ChunkStatistics and are not considered, e.g., chunks that were created after the statistics.
+  TableStatistics(const std::vector<DataType>& column_data_types, std::vector<ChunkStatistics>&& chunk_statistics);
+
+  // Generates the statistics of a single chunk of a table.
+  static ChunkStatistics generate_chunk_statistics(const Table& table, const ChunkID chunk_id);
+
+  // Returns the statistics of all chunks, in the order of their chunk ids.
+  const std::vector<ChunkStatistics>& chunk_statistics() const;
+
+  // Returns the merged statistics of a column.
+  std::shared_ptr<const BaseColumnStatistics> column_statistics(const ColumnID column_id) const;
+
+  // Returns the number of rows that the statistics describe.
+  uint64_t row_count() const;
+
+  // Returns the estimated share of rows that satisfy `column <scan_type> search_value`.
+  double estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                              const AllTypeVariant& search_value) const;
+
+ protected:
+  std::vector<ChunkStatistics> _chunk_statistics;
+  ChunkStatistics _column_statistics;
+};
+
+}  // namespace opossum
@@ -23,8 +23,15 @@ class AbstractAttributeVector : private Noncopyable {
   // Returns the number of values.
   virtual size_t size() const = 0;
 
+  // Decodes the value ids in [begin, end) into the buffer pointed to by out, which has to hold end - begin entries.
+  // Operators should decode batches of a few thousand value ids instead of calling get() for each row.
+  virtual void decode(const size_t begin, const size_t end, ValueID::base_type* out) const = 0;
+
   // Returns the width of biggest value id in bytes.
   virtual AttributeVectorWidth width() const = 0;
+
+  // Returns the calculated memory usage.
+  virtual size_t estimate_memory_usage() const = 0;
 };
 
 }  // namespace opossum
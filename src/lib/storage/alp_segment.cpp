@@ -0,0 +1,250 @@
+#include "alp_segment.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "frame_of_reference_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// The exponent and factor of a block are chosen based on this many evenly spaced values.
+constexpr auto SAMPLE_SIZE = size_t{32};
+
+constexpr double POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                    1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+constexpr double INVERSE_POWERS_OF_TEN[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,  1e-7,  1e-8, 1e-9,
+                                            1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+
+// Floats have fewer significant decimal digits, so larger exponents do not produce exact round trips anyway.
+template <typename T>
+constexpr uint8_t max_exponent() {
+  return std::is_same_v<T, float> ? 10 : 18;
+}
+
+template <typename T>
+T decode_value(const int64_t encoded_value, const uint8_t exponent, const uint8_t factor) {
+  return static_cast<T>(encoded_value) * static_cast<T>(POWERS_OF_TEN[factor]) *
+         static_cast<T>(INVERSE_POWERS_OF_TEN[exponent]);
+}
+
+// Returns the integer representation of a value, or std::nullopt if decoding it would not restore the exact bits.
+template <typename T>
+std::optional<int64_t> encode_value(const T value, const uint8_t exponent, const uint8_t factor) {
+  const auto scaled = value * static_cast<T>(POWERS_OF_TEN[exponent]) * static_cast<T>(INVERSE_POWERS_OF_TEN[factor]);
+  // This also rules out NaN and infinity, for which all comparisons are false.
+  if (!(std::abs(scaled) < static_cast<T>(int64_t{1} << 62))) {
+    return std::nullopt;
+  }
+
+  const auto encoded_value = static_cast<int64_t>(std::llround(scaled));
+  const auto decoded_value = decode_value<T>(encoded_value, exponent, factor);
+  // Comparing bits instead of values rejects -0.0, which would otherwise be restored as 0.0.
+  if (std::memcmp(&decoded_value, &value, sizeof(T)) != 0) {
+    return std::nullopt;
+  }
+  return encoded_value;
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+ALPSegment<T>::ALPSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  static_assert(BLOCK_SIZE == FrameOfReferenceSegment<int64_t>::BLOCK_SIZE,
+                "Blocks of ALPSegment and FrameOfReferenceSegment have to be aligned.");
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Can't encode abstract segment, because it is no value segment.");
+
+  const auto& values = value_segment->values();
+  const auto value_segment_size = value_segment->size();
+  if (value_segment->is_nullable()) {
+    _validity = value_segment->null_values();
+  }
+
+  auto encoded_values = std::vector<int64_t>(value_segment_size);
+  for (auto block_begin = ChunkOffset{0}; block_begin < value_segment_size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, value_segment_size);
+
+    auto sample = std::vector<T>{};
+    const auto stride = std::max(ChunkOffset{1}, static_cast<ChunkOffset>((block_end - block_begin) / SAMPLE_SIZE));
+    for (auto index = block_begin; index < block_end; index += stride) {
+      if (!is_null(index)) {
+        sample.push_back(values[index]);
+      }
+    }
+
+    // Choose the combination with the smallest estimated size: bit-packed integers plus unencoded exceptions.
+    auto best_exponent = uint8_t{0};
+    auto best_factor = uint8_t{0};
+    auto best_cost = std::numeric_limits<size_t>::max();
+    for (auto exponent = uint8_t{0}; exponent <= max_exponent<T>(); ++exponent) {
+      for (auto factor = uint8_t{0}; factor <= exponent; ++factor) {
+        auto exception_count = size_t{0};
+        auto min_value = std::numeric_limits<int64_t>::max();
+        auto max_value = std::numeric_limits<int64_t>::min();
+        for (const auto value : sample) {
+          const auto encoded_value = encode_value(value, exponent, factor);
+          if (!encoded_value) {
+            ++exception_count;
+            continue;
+          }
+          min_value = std::min(min_value, *encoded_value);
+          max_value = std::max(max_value, *encoded_value);
+        }
+
+        const auto encoded_count = sample.size() - exception_count;
+        const auto bit_width =
+            encoded_count > 0 ? std::bit_width(static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value)) : 0;
+        const auto cost = encoded_count * bit_width + exception_count * (sizeof(T) + sizeof(ChunkOffset)) * 8;
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_exponent = exponent;
+          best_factor = factor;
+        }
+      }
+    }
+
+    // NULLs and exceptions are replaced by an encoded value of the block so that they do not widen its range.
+    auto placeholder = std::optional<int64_t>{};
+    auto placeholder_positions = std::vector<ChunkOffset>{};
+    for (auto index = block_begin; index < block_end; ++index) {
+      const auto encoded_value =
+          is_null(index) ? std::nullopt : encode_value(values[index], best_exponent, best_factor);
+      if (encoded_value) {
+        encoded_values[index] = *encoded_value;
+        if (!placeholder) {
+          placeholder = encoded_value;
+        }
+        continue;
+      }
+
+      placeholder_positions.push_back(index);
+      if (!is_null(index)) {
+        _exception_positions.push_back(index);
+        _exception_values.push_back(values[index]);
+      }
+    }
+
+    for (const auto index : placeholder_positions) {
+      encoded_values[index] = placeholder.value_or(0);
+    }
+
+    _block_exponents.push_back(best_exponent);
+    _block_factors.push_back(best_factor);
+  }
+
+  _encoded_values = std::make_shared<FrameOfReferenceSegment<int64_t>>(
+      std::make_shared<ValueSegment<int64_t>>(std::move(encoded_values)));
+}
+
+template <typename T>
+T ALPSegment<T>::_decode_value(const int64_t encoded_value, const size_t block_index) const {
+  return decode_value<T>(encoded_value, _block_exponents[block_index], _block_factors[block_index]);
+}
+
+template <typename T>
+AllTypeVariant ALPSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  if (return_value) {
+    return *return_value;
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+bool ALPSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return !_validity.empty() && _validity.is_null(chunk_offset);
+}
+
+template <typename T>
+T ALPSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  Assert(return_value.has_value(), "Value at position: " + std::to_string(chunk_offset) + " is NULL!");
+  return *return_value;
+}
+
+template <typename T>
+std::optional<T> ALPSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Chunk offset " + std::to_string(chunk_offset) + " is out of range.");
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  const auto exception_iterator =
+      std::lower_bound(_exception_positions.begin(), _exception_positions.end(), chunk_offset);
+  if (exception_iterator != _exception_positions.end() && *exception_iterator == chunk_offset) {
+    return _exception_values[std::distance(_exception_positions.begin(), exception_iterator)];
+  }
+
+  return _decode_value(_encoded_values->get(chunk_offset), chunk_offset / BLOCK_SIZE);
+}
+
+template <typename T>
+void ALPSegment<T>::decode(const ChunkOffset begin, const ChunkOffset end, T* out) const {
+  Assert(begin <= end && end <= size(), "Invalid range for ALPSegment::decode.");
+  auto encoded_values = std::vector<int64_t>(end - begin);
+  _encoded_values->decode(begin, end, encoded_values.data());
+
+  // Convert block by block so that the exponent and factor stay constant within the inner loop.
+  for (auto block_begin = begin; block_begin < end;) {
+    const auto block_index = block_begin / BLOCK_SIZE;
+    const auto block_end = std::min(static_cast<ChunkOffset>((block_index + 1) * BLOCK_SIZE), end);
+    const auto exponent = _block_exponents[block_index];
+    const auto factor = _block_factors[block_index];
+    for (auto index = block_begin; index < block_end; ++index) {
+      out[index - begin] = decode_value<T>(encoded_values[index - begin], exponent, factor);
+    }
+    block_begin = block_end;
+  }
+
+  const auto exceptions_begin = std::lower_bound(_exception_positions.begin(), _exception_positions.end(), begin);
+  const auto exceptions_end = std::lower_bound(exceptions_begin, _exception_positions.end(), end);
+  for (auto exception_iterator = exceptions_begin; exception_iterator != exceptions_end; ++exception_iterator) {
+    const auto exception_index = std::distance(_exception_positions.begin(), exception_iterator);
+    out[*exception_iterator - begin] = _exception_values[exception_index];
+  }
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& ALPSegment<T>::exception_positions() const {
+  return _exception_positions;
+}
+
+template <typename T>
+void ALPSegment<T>::materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out,
+                                      ValidityBitmap* nulls) const {
+  decode(begin, end, out);
+  if (nulls) {
+    if (_validity.empty()) {
+      nulls->assign(end - begin, true);
+    } else {
+      nulls->assign(_validity, begin, end);
+    }
+  }
+}
+
+template <typename T>
+ChunkOffset ALPSegment<T>::size() const {
+  return _encoded_values->size();
+}
+
+template <typename T>
+size_t ALPSegment<T>::estimate_memory_usage() const {
+  return _encoded_values->estimate_memory_usage() + _block_exponents.size() + _block_factors.size() +
+         _exception_positions.size() * sizeof(ChunkOffset) + _exception_values.size() * sizeof(T) +
+         _validity.estimate_memory_usage();
+}
+
+template class ALPSegment<float>;
+template class ALPSegment<double>;
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+#include "validity_bitmap.hpp"
+
+namespace opossum {
+
+template <typename T>
+class FrameOfReferenceSegment;
+
+// ALPSegment is a lossless segment type for float and double columns, following the idea of Adaptive Lossless
+// floating-Point compression (ALP). Many floating-point values, e.g., sensor measurements, originate from decimals with
+// few digits. Multiplying them with a power of ten (10^exponent) and dividing by another one (10^factor) yields an
+// integer from which the exact value can be restored. For each block of BLOCK_SIZE rows, the exponent and factor are
+// chosen based on a sample. The resulting integers are stored in a FrameOfReferenceSegment, i.e., bit-packed with the
+// block's minimum as reference. Values that do not survive the round trip (e.g., NaN, -0.0, or values with too many
+// digits) are stored unencoded in a sorted exception list. The blocks of both segment types are aligned, so that
+// decode() can restore whole blocks at once.
+template <typename T>
+class ALPSegment : public AbstractSegment {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  // Creates an ALPSegment from a given value segment.
+  explicit ALPSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Decodes the values in [begin, end) into the buffer pointed to by out, which has to hold end - begin entries. The
+  // content of NULL positions is undefined.
+  void decode(const ChunkOffset begin, const ChunkOffset end, T* out) const;
+
+  // Same as decode, but additionally refills nulls (if given) with the validity of the rows.
+  void materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out, ValidityBitmap* nulls) const;
+
+  // Returns the chunk offsets of all values that could not be encoded as integers, in ascending order.
+  const std::vector<ChunkOffset>& exception_positions() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Restores a value from its integer representation using the exponent and factor of the given block.
+  T _decode_value(const int64_t encoded_value, const size_t block_index) const;
+
+  std::shared_ptr<FrameOfReferenceSegment<int64_t>> _encoded_values;
+  std::vector<uint8_t> _block_exponents;
+  std::vector<uint8_t> _block_factors;
+  std::vector<ChunkOffset> _exception_positions;
+  std::vector<T> _exception_values;
+  // Empty if the segment is not nullable.
+  ValidityBitmap _validity;
+};
+
+extern template class ALPSegment<float>;
+extern template class ALPSegment<double>;
+
+}  // namespace opossum
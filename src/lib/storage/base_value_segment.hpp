@@ -0,0 +1,15 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+
+namespace opossum {
+
+// BaseValueSegment is the base class of all ValueSegments. It allows to append values without resolving the data type
+// of the segment first, e.g., when a chunk appends a row.
+class BaseValueSegment : public AbstractSegment {
+ public:
+  // Adds a value at the end of the segment.
+  virtual void append(const AllTypeVariant& value) = 0;
+};
+
+}  // namespace opossum
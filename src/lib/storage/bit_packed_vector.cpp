@@ -0,0 +1,104 @@
+#include "bit_packed_vector.hpp"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Values are read and written as unaligned little-endian 64-bit words. A value with up to 32 bits starts at most seven
+// bits into the first byte, so it always fits into a single word.
+static_assert(std::endian::native == std::endian::little, "BitPackedVector requires a little-endian architecture.");
+
+BitPackedVector::BitPackedVector(const size_t size, const uint8_t bit_width)
+    : _size(size), _bit_width(bit_width), _mask((uint64_t{1} << bit_width) - 1) {
+  Assert(bit_width >= 1 && bit_width <= 32, "BitPackedVector supports bit widths between 1 and 32.");
+  // One additional word of padding allows us to always load eight bytes, even for the last value.
+  _words.resize((size * bit_width + 63) / 64 + 1);
+}
+
+uint64_t BitPackedVector::_load_word(const size_t bit_position) const {
+  auto word = uint64_t{};
+  std::memcpy(&word, reinterpret_cast<const char*>(_words.data()) + (bit_position >> 3), sizeof(word));
+  return word;
+}
+
+ValueID BitPackedVector::get(const size_t index) const {
+  DebugAssert(index < _size, "index " + std::to_string(index) + " out of bounds for BitPackedVector with size " +
+                                 std::to_string(_size));
+  const auto bit_position = index * _bit_width;
+  return ValueID{static_cast<ValueID::base_type>((_load_word(bit_position) >> (bit_position & 7)) & _mask)};
+}
+
+void BitPackedVector::set(const size_t index, const ValueID value_id) {
+  Assert(index < _size, "index " + std::to_string(index) + " out of bounds for BitPackedVector with size " +
+                            std::to_string(_size));
+  DebugAssert(static_cast<uint64_t>(value_id) <= _mask,
+              "ValueID " + std::to_string(value_id) + " does not fit into " + std::to_string(_bit_width) + " bits.");
+  const auto bit_position = index * _bit_width;
+  const auto shift = bit_position & 7;
+  auto word = _load_word(bit_position);
+  word &= ~(_mask << shift);
+  word |= (static_cast<uint64_t>(value_id) & _mask) << shift;
+  std::memcpy(reinterpret_cast<char*>(_words.data()) + (bit_position >> 3), &word, sizeof(word));
+}
+
+size_t BitPackedVector::size() const {
+  return _size;
+}
+
+AttributeVectorWidth BitPackedVector::width() const {
+  return static_cast<AttributeVectorWidth>((_bit_width + 7) / 8);
+}
+
+size_t BitPackedVector::estimate_memory_usage() const {
+  return _words.size() * sizeof(uint64_t);
+}
+
+uint8_t BitPackedVector::bit_width() const {
+  return _bit_width;
+}
+
+void BitPackedVector::decode(const size_t begin, const size_t end, ValueID::base_type* out) const {
+  Assert(begin <= end && end <= _size, "Invalid range for BitPackedVector::decode.");
+  auto index = begin;
+
+#if defined(__AVX2__)
+  // Each lane gathers the four bytes containing its value and shifts it into place. Values of up to 25 bits starting
+  // at most seven bits into a byte fit into these four bytes. Wider values are rare (i.e., dictionaries with more than
+  // 2^25 entries) and use the scalar loop below.
+  if (_bit_width <= 25) {
+    const auto* const bytes = reinterpret_cast<const char*>(_words.data());
+    const auto lane_bits =
+        _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(_bit_width));
+    const auto mask = _mm256_set1_epi32(static_cast<int32_t>(_mask));
+    const auto seven = _mm256_set1_epi32(7);
+
+    for (; index + 8 <= end; index += 8) {
+      // Positions are relative to the byte containing the first value of this batch so that they fit into 32 bits.
+      const auto bit_position = index * _bit_width;
+      const auto relative_bits =
+          _mm256_add_epi32(lane_bits, _mm256_set1_epi32(static_cast<int32_t>(bit_position & 7)));
+      const auto byte_offsets = _mm256_srli_epi32(relative_bits, 3);
+      const auto shifts = _mm256_and_si256(relative_bits, seven);
+
+      const auto gathered = _mm256_i32gather_epi32(reinterpret_cast<const int*>(bytes + (bit_position >> 3)),
+                                                   byte_offsets, 1);
+      const auto values = _mm256_and_si256(_mm256_srlv_epi32(gathered, shifts), mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + (index - begin)), values);
+    }
+  }
+#endif
+
+  for (; index < end; ++index) {
+    const auto bit_position = index * _bit_width;
+    out[index - begin] = static_cast<ValueID::base_type>((_load_word(bit_position) >> (bit_position & 7)) & _mask);
+  }
+}
+
+}  // namespace opossum
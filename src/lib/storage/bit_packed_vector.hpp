@@ -0,0 +1,48 @@
+#pragma once
+
+#include "abstract_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedVector stores value ids with exactly as many bits as the largest value id requires (1 to 32 bits). The
+// values are packed back to back without any padding between them, i.e., a value may span a byte boundary. Compared to
+// FixedWidthIntegerVector, this saves memory for all dictionaries whose size is not close to a power of 2^8, 2^16, or
+// 2^32 and increases the number of rows per cache line.
+class BitPackedVector final : public AbstractAttributeVector {
+ public:
+  BitPackedVector(const size_t size, const uint8_t bit_width);
+
+  // Returns the value id at a given position.
+  ValueID get(const size_t index) const override;
+
+  // Sets the value id at a given position. The value id must fit into bit_width() bits.
+  void set(const size_t index, const ValueID value_id) override;
+
+  // Returns the number of values.
+  size_t size() const override;
+
+  // Returns the number of bytes needed to store the biggest value id (i.e., bit_width() rounded up to full bytes).
+  AttributeVectorWidth width() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const override;
+
+  // Returns the number of bits used per value id.
+  uint8_t bit_width() const;
+
+  // Decodes the value ids in [begin, end) into the buffer pointed to by out, which has to hold end - begin entries. If
+  // the library is compiled with AVX2 support, eight values are unpacked at once using gathers and variable shifts.
+  void decode(const size_t begin, const size_t end, ValueID::base_type* out) const override;
+
+ protected:
+  // Reads the eight bytes starting at the byte that contains the first bit of the value at the given index.
+  uint64_t _load_word(const size_t bit_position) const;
+
+  std::vector<uint64_t> _words;
+  size_t _size;
+  uint8_t _bit_width;
+  uint64_t _mask;
+};
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#include "bloom_filter.hpp"
+
+#include <functional>
+#include <string_view>
+
+#include "segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// std::hash maps integers to themselves. Multiplying with this odd constant (2^64 divided by the golden ratio) spreads
+// their bits over the high bits of the hash, which select the block.
+constexpr auto HASH_MULTIPLIER = uint64_t{0x9E3779B97F4A7C15};
+
+// Each word of a block takes its bit from the lower half of the hash multiplied with a different odd constant.
+constexpr auto BLOCK_SALTS = std::array<uint32_t, 8>{0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                     0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+// Hashes strings as string_views, which hash equal to std::strings with the same characters. segment_iterate passes
+// string_views, so the values do not have to be copied.
+template <typename Value>
+uint64_t bloom_filter_hash(const Value& value) {
+  return static_cast<uint64_t>(std::hash<Value>{}(value)) * HASH_MULTIPLIER;
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+BloomFilter<T>::BloomFilter(const AbstractSegment& segment) {
+  // The number of distinct values is unknown, so the filter is sized for all rows of the segment.
+  const auto block_bits = sizeof(Block) * 8;
+  const auto block_count = std::max(size_t{1}, (segment.size() * BITS_PER_VALUE + block_bits - 1) / block_bits);
+  _blocks.resize(block_count, Block{});
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null) {
+      return;
+    }
+    const auto hash = bloom_filter_hash(position.value);
+    auto& block = _blocks[_block_index(hash)];
+    const auto masks = _masks(hash);
+    for (auto word_index = size_t{0}; word_index < masks.size(); ++word_index) {
+      block.words[word_index] |= masks[word_index];
+    }
+  });
+}
+
+template <typename T>
+bool BloomFilter<T>::may_contain(const AllTypeVariant& value) const {
+  const auto* typed_value = boost::get<T>(&value);
+  return !typed_value || may_contain_typed(*typed_value);
+}
+
+template <typename T>
+bool BloomFilter<T>::may_contain_typed(const T& value) const {
+  const auto hash = [&]() {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return bloom_filter_hash(std::string_view{value});
+    } else {
+      return bloom_filter_hash(value);
+    }
+  }();
+  const auto& block = _blocks[_block_index(hash)];
+  const auto masks = _masks(hash);
+  // Testing all words without branching allows the compiler to vectorize the loop.
+  auto missing_bits = uint64_t{0};
+  for (auto word_index = size_t{0}; word_index < masks.size(); ++word_index) {
+    missing_bits |= masks[word_index] & ~block.words[word_index];
+  }
+  return missing_bits == 0;
+}
+
+template <typename T>
+size_t BloomFilter<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _blocks.capacity() * sizeof(Block);
+}
+
+template <typename T>
+std::array<uint64_t, 8> BloomFilter<T>::_masks(const uint64_t hash) {
+  auto masks = std::array<uint64_t, 8>{};
+  const auto key = static_cast<uint32_t>(hash);
+  for (auto word_index = size_t{0}; word_index < masks.size(); ++word_index) {
+    masks[word_index] = uint64_t{1} << ((key * BLOCK_SALTS[word_index]) >> 26);
+  }
+  return masks;
+}
+
+template <typename T>
+size_t BloomFilter<T>::_block_index(const uint64_t hash) const {
+  // Maps the upper half of the hash to [0, block count) with a multiplication instead of a modulo.
+  return static_cast<size_t>(((hash >> 32) * _blocks.size()) >> 32);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BloomFilter);
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// BaseBloomFilter is the base class of all BloomFilters. It allows chunks to query the filters of their segments
+// without resolving the data type first.
+class BaseBloomFilter : private Noncopyable {
+ public:
+  virtual ~BaseBloomFilter() = default;
+
+  // Returns false if the segment certainly does not contain the value. NULL search values and search values of another
+  // data type than the segment always return true.
+  virtual bool may_contain(const AllTypeVariant& value) const = 0;
+
+  // Returns the calculated memory usage.
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+// A BloomFilter tells whether a segment may contain a value, so that equality scans and join probes can skip segments
+// that certainly do not. Unlike a zone map, it also helps for columns such as keys whose values spread over the whole
+// range in every chunk. The filter is blocked: a value only sets and tests bits within one block of 512 bits, which
+// is a single cache line, so each lookup causes at most one cache miss. Within the block, one bit is set in each of
+// the eight 64-bit words (a "split block" filter). With BITS_PER_VALUE bits per value, about one in a thousand values
+// that are not in the segment are reported as possibly contained.
+template <typename T>
+class BloomFilter : public BaseBloomFilter {
+ public:
+  static constexpr auto BITS_PER_VALUE = size_t{16};
+
+  // Creates the filter of the given segment, which may use any encoding. NULL values are not inserted.
+  explicit BloomFilter(const AbstractSegment& segment);
+
+  bool may_contain(const AllTypeVariant& value) const final;
+
+  // Same as may_contain(AllTypeVariant) without resolving the type of the value.
+  bool may_contain_typed(const T& value) const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  struct alignas(64) Block {
+    std::array<uint64_t, 8> words;
+  };
+
+  // Returns the bit that a hash sets in each word of its block.
+  static std::array<uint64_t, 8> _masks(const uint64_t hash);
+
+  // Returns the index of the block that a hash is mapped to.
+  size_t _block_index(const uint64_t hash) const;
+
+  std::vector<Block> _blocks;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(BloomFilter);
+
+}  // namespace opossum
@@ -1,35 +1,62 @@
 #include "chunk.hpp"
 
-#include "abstract_segment.hpp"
-#include "resolve_type.hpp"
+#include <algorithm>
+
+#include "base_value_segment.hpp"
+#include "bloom_filter.hpp"
+#include "index/base_index.hpp"
 #include "utils/assert.hpp"
-#include "value_segment.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(const std::shared_ptr<AbstractSegment> segment) {
+void Chunk::add_segment(const std::shared_ptr<AbstractSegment> segment, const std::shared_ptr<BaseZoneMap>& zone_map,
+                        const std::shared_ptr<const BaseBloomFilter>& bloom_filter) {
   _segments.push_back(segment);
+  _zone_maps.push_back(zone_map);
+  _bloom_filters.push_back(bloom_filter);
+  _indexes.emplace_back();
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
-  static const auto data_types = std::vector<std::string>{"int", "long", "float", "double", "string"};
   const auto column_count = _segments.size();
   Assert(values.size() == column_count, "Number of segments does not match value list.");
 
+  const auto chunk_offset = size();
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    auto success = false;
-    for (const auto& data_type : data_types) {
-      if (success) {
-        break;
-      }
-      resolve_data_type(data_type, [&](auto type) {
-        using DataType = typename decltype(type)::type;
-        if (const auto& typed_segment = std::dynamic_pointer_cast<ValueSegment<DataType>>(_segments[column_id])) {
-          typed_segment->append(values[column_id]);
-          success = true;
-        }
-      });
+    // A cast of the raw pointer avoids modifying the reference count of the shared_ptr.
+    const auto value_segment = dynamic_cast<BaseValueSegment*>(_segments[column_id].get());
+    Assert(value_segment, "Values can only be appended to ValueSegments.");
+    value_segment->append(values[column_id]);
+    if (_zone_maps[column_id]) {
+      _zone_maps[column_id]->append(values[column_id]);
+    }
+    if (_indexes[column_id]) {
+      _indexes[column_id]->insert(values[column_id], chunk_offset);
+    }
+  }
+
+  // Compares the appended values with the cached values of the previous row. As both are read from the segments, they
+  // have the data type of the column, so that the variants can be compared.
+  for (auto index = size_t{0}; index < _sorted_by.size();) {
+    const auto& sort_column_definition = _sorted_by[index];
+    const auto value = (*_segments[sort_column_definition.column])[chunk_offset];
+    const auto& previous_value = _last_sorted_values[index];
+    auto is_ordered = true;
+    if (variant_is_null(value)) {
+      is_ordered = variant_is_null(previous_value);
+    } else if (!variant_is_null(previous_value)) {
+      is_ordered = sort_column_definition.sort_mode == SortMode::Ascending ? !(value < previous_value)
+                                                                            : !(previous_value < value);
+    }
+
+    if (!is_ordered) {
+      _sorted_by.erase(_sorted_by.begin() + index);
+      _last_sorted_values.erase(_last_sorted_values.begin() + index);
+      continue;
     }
+    _last_sorted_values[index] = value;
+    ++index;
   }
 }
 
@@ -37,6 +64,59 @@ std::shared_ptr<AbstractSegment> Chunk::get_segment(const ColumnID column_id) co
   return _segments.at(column_id);
 }
 
+std::shared_ptr<BaseZoneMap> Chunk::get_zone_map(const ColumnID column_id) const {
+  return _zone_maps.at(column_id);
+}
+
+std::shared_ptr<const BaseBloomFilter> Chunk::get_bloom_filter(const ColumnID column_id) const {
+  return _bloom_filters.at(column_id);
+}
+
+void Chunk::set_index(const ColumnID column_id, const std::shared_ptr<BaseIndex>& index) {
+  _indexes.at(column_id) = index;
+}
+
+std::shared_ptr<BaseIndex> Chunk::get_index(const ColumnID column_id) const {
+  return _indexes.at(column_id);
+}
+
+bool Chunk::can_prune(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto& zone_map = _zone_maps.at(column_id);
+  if (zone_map && zone_map->can_prune(scan_type, search_value)) {
+    return true;
+  }
+  const auto& bloom_filter = _bloom_filters[column_id];
+  return scan_type == ScanType::OpEquals && bloom_filter && !bloom_filter->may_contain(search_value);
+}
+
+void Chunk::set_individually_sorted_by(const std::vector<SortColumnDefinition>& sorted_by) {
+  for (const auto& sort_column_definition : sorted_by) {
+    Assert(sort_column_definition.column < column_count(), "Chunk cannot be sorted by a column it does not have.");
+  }
+  _sorted_by = sorted_by;
+
+  const auto chunk_size = size();
+  _last_sorted_values.clear();
+  for (const auto& sort_column_definition : sorted_by) {
+    _last_sorted_values.push_back(chunk_size ? (*_segments[sort_column_definition.column])[chunk_size - 1]
+                                             : NULL_VALUE);
+  }
+}
+
+const std::vector<SortColumnDefinition>& Chunk::individually_sorted_by() const {
+  return _sorted_by;
+}
+
+std::optional<SortMode> Chunk::sort_mode(const ColumnID column_id) const {
+  const auto sort_column_definition =
+      std::find_if(_sorted_by.begin(), _sorted_by.end(),
+                   [&](const auto& definition) { return definition.column == column_id; });
+  if (sort_column_definition == _sorted_by.end()) {
+    return std::nullopt;
+  }
+  return sort_column_definition->sort_mode;
+}
+
 ColumnCount Chunk::column_count() const {
   return ColumnCount(_segments.size());
 }
@@ -1,13 +1,16 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class BaseBloomFilter;
 class BaseIndex;
+class BaseZoneMap;
 class AbstractSegment;
 
 // A chunk is a horizontal partition of a table. For each column in the table, it holds one segment. The segments
@@ -19,8 +22,12 @@ class Chunk : private Noncopyable {
   // Creates an empty chunk.
   Chunk() = default;
 
-  // Adds a segment to the "right" of the chunk.
-  void add_segment(const std::shared_ptr<AbstractSegment> segment);
+  // Adds a segment to the "right" of the chunk. The zone map and the Bloom filter, if given, have to describe the
+  // values of the segment. Segments without them are never pruned. As Bloom filters cannot be maintained on append,
+  // they are meant for immutable (i.e., compressed) segments.
+  void add_segment(const std::shared_ptr<AbstractSegment> segment,
+                   const std::shared_ptr<BaseZoneMap>& zone_map = nullptr,
+                   const std::shared_ptr<const BaseBloomFilter>& bloom_filter = nullptr);
 
   // Returns the number of columns (cannot exceed ColumnID (uint16_t)).
   ColumnCount column_count() const;
@@ -29,16 +36,54 @@ class Chunk : private Noncopyable {
   ChunkOffset size() const;
 
   // Adds a new row, given as a list of values, to the chunk. Note this is slow and not thread-safe and should be used
-  // for testing purposes only.
+  // for testing purposes only. The zone maps and indexes of the segments are updated as well. If the row breaks the
+  // order of a column that the chunk is sorted by, the chunk is no longer considered to be sorted by it.
   void append(const std::vector<AllTypeVariant>& values);
 
   // Returns the segment at a given position.
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
+  // Returns the zone map of the segment at a given position, or nullptr if it has none.
+  std::shared_ptr<BaseZoneMap> get_zone_map(ColumnID column_id) const;
+
+  // Returns the Bloom filter of the segment at a given position, or nullptr if it has none. Join probes can use it to
+  // skip chunks that do not contain a key.
+  std::shared_ptr<const BaseBloomFilter> get_bloom_filter(ColumnID column_id) const;
+
+  // Sets the index of the segment at a given position. It has to be built on the segment of the chunk. If rows are
+  // still appended to the chunk, the index has to support BaseIndex::insert.
+  void set_index(const ColumnID column_id, const std::shared_ptr<BaseIndex>& index);
+
+  // Returns the index of the segment at a given position, or nullptr if it has none.
+  std::shared_ptr<BaseIndex> get_index(const ColumnID column_id) const;
+
+  // Returns whether no row of the chunk can satisfy `column <scan_type> search_value`, so that a scan can skip the
+  // whole chunk. Returns false if this cannot be decided, e.g., because the segment has no zone map. Equality
+  // predicates also consult the Bloom filter.
+  bool can_prune(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) const;
+
   void add_segment_at_index(const std::shared_ptr<AbstractSegment> segment, ColumnID index);
 
+  // Declares that the segment of each of the given columns is sorted on its own, so that scans can search them with
+  // binary searches (see sorted_segment_search). The declaration is not verified.
+  void set_individually_sorted_by(const std::vector<SortColumnDefinition>& sorted_by);
+
+  // Returns the columns by which the chunk is sorted.
+  const std::vector<SortColumnDefinition>& individually_sorted_by() const;
+
+  // Returns the order of a column, or std::nullopt if the chunk is not known to be sorted by it.
+  std::optional<SortMode> sort_mode(const ColumnID column_id) const;
+
  protected:
   std::vector<std::shared_ptr<AbstractSegment>> _segments;
+  // These hold nullptr for segments without a zone map, Bloom filter, or index.
+  std::vector<std::shared_ptr<BaseZoneMap>> _zone_maps;
+  std::vector<std::shared_ptr<const BaseBloomFilter>> _bloom_filters;
+  std::vector<std::shared_ptr<BaseIndex>> _indexes;
+  std::vector<SortColumnDefinition> _sorted_by;
+  // The last value of each column in _sorted_by, so that appended rows are only compared with the cached values. It is
+  // NULL_VALUE for empty chunks, as NULLs come first.
+  std::vector<AllTypeVariant> _last_sorted_values;
 };
 
 }  // namespace opossum
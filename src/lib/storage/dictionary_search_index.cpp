@@ -0,0 +1,159 @@
+#include "dictionary_search_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <functional>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Batched searches advance this many searches by one level each, before continuing with the next level. The node a
+// search visits next is prefetched and only accessed after the other searches of the group made their step.
+constexpr auto SEARCH_GROUP_SIZE = size_t{16};
+
+// Multiplying with this odd constant (2^64 divided by the golden ratio) spreads the bits of the hash over the high
+// bits, from which the slot is taken. Integers are hashed to themselves by std::hash, which would otherwise place
+// values that differ by a power of two into the same slot.
+constexpr auto HASH_MULTIPLIER = uint64_t{0x9E3779B97F4A7C15};
+
+// Fills the Eytzinger layout by an in-order traversal of the implicit tree, which visits the nodes in sorted order.
+template <typename T>
+void build_eytzinger(const std::vector<T>& sorted_values, std::vector<T>& eytzinger_values,
+                     std::vector<uint32_t>& eytzinger_positions, size_t& sorted_position, const size_t index) {
+  if (index >= eytzinger_values.size()) {
+    return;
+  }
+  build_eytzinger(sorted_values, eytzinger_values, eytzinger_positions, sorted_position, 2 * index);
+  eytzinger_values[index] = sorted_values[sorted_position];
+  eytzinger_positions[index] = static_cast<uint32_t>(sorted_position);
+  ++sorted_position;
+  build_eytzinger(sorted_values, eytzinger_values, eytzinger_positions, sorted_position, 2 * index + 1);
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+DictionarySearchIndex<T>::DictionarySearchIndex(const std::vector<T>& sorted_values)
+    : _eytzinger_values(sorted_values.size() + 1), _eytzinger_positions(sorted_values.size() + 1) {
+  Assert(sorted_values.size() < std::numeric_limits<uint32_t>::max(), "Too many values for a search index.");
+  auto sorted_position = size_t{0};
+  build_eytzinger(sorted_values, _eytzinger_values, _eytzinger_positions, sorted_position, 1);
+}
+
+template <typename T>
+size_t DictionarySearchIndex<T>::lower_bound(const T& value) const {
+  const auto value_count = size();
+  auto index = size_t{1};
+  while (index <= value_count) {
+    index = 2 * index + static_cast<size_t>(_eytzinger_values[index] < value);
+  }
+  // The search went right after every value smaller than the search value. The last node at which it went left is
+  // the result. Removing the trailing right turns and the final left turn from the path yields its index.
+  index >>= std::countr_one(index) + 1;
+  return index == 0 ? value_count : _eytzinger_positions[index];
+}
+
+template <typename T>
+size_t DictionarySearchIndex<T>::upper_bound(const T& value) const {
+  const auto value_count = size();
+  auto index = size_t{1};
+  while (index <= value_count) {
+    index = 2 * index + static_cast<size_t>(!(value < _eytzinger_values[index]));
+  }
+  index >>= std::countr_one(index) + 1;
+  return index == 0 ? value_count : _eytzinger_positions[index];
+}
+
+template <typename T>
+void DictionarySearchIndex<T>::lower_bound(const T* values, const size_t value_count, size_t* positions) const {
+  const auto dictionary_size = size();
+  // Every search ends below the leaves after as many steps as the tree has levels.
+  const auto level_count = std::bit_width(dictionary_size);
+  auto indices = std::array<size_t, SEARCH_GROUP_SIZE>{};
+
+  for (auto group_begin = size_t{0}; group_begin < value_count; group_begin += SEARCH_GROUP_SIZE) {
+    const auto group_size = std::min(SEARCH_GROUP_SIZE, value_count - group_begin);
+    const auto* group_values = values + group_begin;
+    std::fill(indices.begin(), indices.end(), size_t{1});
+
+    for (auto level = size_t{0}; level < level_count; ++level) {
+      for (auto search_index = size_t{0}; search_index < group_size; ++search_index) {
+        auto& index = indices[search_index];
+        if (index > dictionary_size) {
+          continue;
+        }
+        index = 2 * index + static_cast<size_t>(_eytzinger_values[index] < group_values[search_index]);
+        if (index <= dictionary_size) {
+          __builtin_prefetch(&_eytzinger_values[index]);
+        }
+      }
+    }
+
+    for (auto search_index = size_t{0}; search_index < group_size; ++search_index) {
+      auto index = indices[search_index];
+      index >>= std::countr_one(index) + 1;
+      positions[group_begin + search_index] = index == 0 ? dictionary_size : _eytzinger_positions[index];
+    }
+  }
+}
+
+template <typename T>
+size_t DictionarySearchIndex<T>::find(const T& value) const {
+  std::call_once(_hash_table_flag, [&] { _build_hash_table(); });
+
+  const auto slot_mask = _hash_slots.size() - 1;
+  for (auto slot = _hash_slot(value);; slot = (slot + 1) & slot_mask) {
+    const auto index = _hash_slots[slot];
+    if (index == 0) {
+      return size();
+    }
+    if (_eytzinger_values[index] == value) {
+      return _eytzinger_positions[index];
+    }
+  }
+}
+
+template <typename T>
+size_t DictionarySearchIndex<T>::size() const {
+  return _eytzinger_values.size() - 1;
+}
+
+template <typename T>
+size_t DictionarySearchIndex<T>::estimate_memory_usage() const {
+  const auto hash_slot_count = _has_hash_table ? _hash_slots.capacity() : size_t{0};
+  return _eytzinger_values.capacity() * sizeof(T) +
+         (_eytzinger_positions.capacity() + hash_slot_count) * sizeof(uint32_t);
+}
+
+template <typename T>
+void DictionarySearchIndex<T>::_build_hash_table() const {
+  // With at most half of the slots occupied, linear probing needs few steps on average.
+  const auto slot_count = std::bit_ceil(std::max(2 * size(), size_t{2}));
+  _hash_shift = static_cast<uint8_t>(64 - std::countr_zero(slot_count));
+  _hash_slots.resize(slot_count);
+  const auto slot_mask = slot_count - 1;
+  for (auto index = size_t{1}; index < _eytzinger_values.size(); ++index) {
+    auto slot = _hash_slot(_eytzinger_values[index]);
+    while (_hash_slots[slot] != 0) {
+      slot = (slot + 1) & slot_mask;
+    }
+    _hash_slots[slot] = static_cast<uint32_t>(index);
+  }
+  _has_hash_table = true;
+}
+
+template <typename T>
+size_t DictionarySearchIndex<T>::_hash_slot(const T& value) const {
+  return static_cast<size_t>((static_cast<uint64_t>(std::hash<T>{}(value)) * HASH_MULTIPLIER) >> _hash_shift);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySearchIndex);
+
+}  // namespace opossum
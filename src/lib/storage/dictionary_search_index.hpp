@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// DictionarySearchIndex speeds up searching large sorted dictionaries. A binary search over a sorted vector touches a
+// different cache line in almost every step. Instead, range searches run over a copy of the values in Eytzinger
+// (breadth-first) order: the children of the node at index k are stored at 2k and 2k + 1, so the first levels share a
+// few cache lines and the nodes of the next steps can be prefetched. Equality searches probe an open-addressing hash
+// table that points into the Eytzinger copy. The hash table is built by the first equality search, so that
+// dictionaries that are only searched for ranges do not pay for it. All searches return positions in the sorted
+// dictionary. Small
+// dictionaries fit into the caches, where the plain binary search is just as fast, so DictionarySegment only builds
+// the index for dictionaries with at least MIN_DICTIONARY_SIZE values.
+template <typename T>
+class DictionarySearchIndex : private Noncopyable {
+ public:
+  static constexpr auto MIN_DICTIONARY_SIZE = size_t{1} << 12;
+
+  // Creates the index for values that are sorted in ascending order and unique.
+  explicit DictionarySearchIndex(const std::vector<T>& sorted_values);
+
+  // Returns the position of the first value >= the search value, or size() if all values are smaller.
+  size_t lower_bound(const T& value) const;
+
+  // Returns the position of the first value > the search value, or size() if all values are smaller or equal.
+  size_t upper_bound(const T& value) const;
+
+  // Writes the lower_bound of each search value to positions. The searches run interleaved, so that the memory
+  // accesses of one search overlap with the comparisons of the others.
+  void lower_bound(const T* values, const size_t value_count, size_t* positions) const;
+
+  // Returns the position of the value, or size() if the dictionary does not contain it. The first call builds the hash
+  // table.
+  size_t find(const T& value) const;
+
+  // Returns the number of values.
+  size_t size() const;
+
+  // Returns the calculated memory usage. It includes the hash table only once it was built.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // Fills the hash table with all values. It is called once, by the first find().
+  void _build_hash_table() const;
+
+  // Returns the slot of the hash table at which the probing for a value starts.
+  size_t _hash_slot(const T& value) const;
+
+  // The values in Eytzinger order, starting at index 1. Index 0 holds an unused default value.
+  std::vector<T> _eytzinger_values;
+  // The position in the sorted dictionary of each value in _eytzinger_values.
+  std::vector<uint32_t> _eytzinger_positions;
+  // Each slot holds an index into _eytzinger_values, or 0 if it is empty. The index is shared by the segments of a
+  // column and searched concurrently, so the hash table is built under _hash_table_flag.
+  mutable std::vector<uint32_t> _hash_slots;
+  // The hash table has 2^(64 - _hash_shift) slots. The slot of a value is taken from the high bits of its hash.
+  mutable uint8_t _hash_shift{0};
+  mutable std::once_flag _hash_table_flag;
+  mutable std::atomic<bool> _has_hash_table{false};
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(DictionarySearchIndex);
+
+}  // namespace opossum
@@ -1,18 +1,195 @@
 #include "dictionary_segment.hpp"
 
-#include <map>
-#include <set>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+#include "bit_packed_vector.hpp"
 #include "fixed_width_integer_vector.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "validity_bitmap.hpp"
 #include "value_segment.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Segments are split into partitions of this many rows for building the dictionary. Smaller segments are built by the
+// calling thread, as starting a thread costs more than sorting them.
+constexpr auto ROWS_PER_PARTITION = size_t{1} << 18;
+
+// Integer value ids are looked up in a table if the values span less than the maximum of both bounds.
+constexpr auto MIN_DENSE_LOOKUP_RANGE = uint64_t{1} << 16;
+constexpr auto DENSE_LOOKUP_RANGE_FACTOR = uint64_t{4};
+
+// materialize_range decodes this many value ids at once into a buffer on the stack.
+constexpr auto MATERIALIZE_BATCH_SIZE = ChunkOffset{2048};
+
+// Strings are sorted, merged and searched as GermanStrings that point into the value segment, so that most comparisons
+// are decided by the inlined prefixes and no value is copied before the dictionary itself is built.
+template <typename T>
+using SortKey = std::conditional_t<std::is_same_v<T, std::string>, GermanString, T>;
+
+template <typename T>
+SortKey<T> sort_key(const typename ValueSegment<T>::ValueVector& values, const size_t index) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return values.german_string(index);
+  } else {
+    return values[index];
+  }
+}
+
+// Calls the functor for each partition index. The partitions are distributed round-robin over up to max_thread_count
+// threads, or up to one thread per core if max_thread_count is 0.
+template <typename Functor>
+void run_partitioned(const size_t partition_count, const size_t max_thread_count, const Functor& functor) {
+  const auto core_count = size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+  const auto thread_count = std::min(partition_count, max_thread_count > 0 ? max_thread_count : core_count);
+  if (thread_count <= 1) {
+    for (auto partition_index = size_t{0}; partition_index < partition_count; ++partition_index) {
+      functor(partition_index);
+    }
+    return;
+  }
+
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(thread_count);
+  for (auto thread_index = size_t{0}; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto partition_index = thread_index; partition_index < partition_count; partition_index += thread_count) {
+        functor(partition_index);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+// Sorts integers with a least significant digit radix sort over their bytes. Flipping the sign bit maps signed values
+// to unsigned keys with the same order. Passes in which all keys have the same byte are skipped.
+template <typename T>
+void radix_sort(std::vector<T>& values) {
+  using UnsignedT = std::make_unsigned_t<T>;
+  constexpr auto SIGN_BIT = UnsignedT{1} << (sizeof(T) * 8 - 1);
+  const auto key = [](const T value) { return static_cast<UnsignedT>(static_cast<UnsignedT>(value) ^ SIGN_BIT); };
+
+  auto histograms = std::array<std::array<size_t, 256>, sizeof(T)>{};
+  for (const auto value : values) {
+    const auto value_key = key(value);
+    for (auto byte_index = size_t{0}; byte_index < sizeof(T); ++byte_index) {
+      ++histograms[byte_index][(value_key >> (byte_index * 8)) & 0xFF];
+    }
+  }
+
+  auto buffer = std::vector<T>(values.size());
+  for (auto byte_index = size_t{0}; byte_index < sizeof(T); ++byte_index) {
+    auto& histogram = histograms[byte_index];
+    if (std::find(histogram.begin(), histogram.end(), values.size()) != histogram.end()) {
+      continue;
+    }
+
+    // Turn the counts into the first output position of each byte value.
+    auto offset = size_t{0};
+    for (auto& count : histogram) {
+      offset += std::exchange(count, offset);
+    }
+    for (const auto value : values) {
+      buffer[histogram[(key(value) >> (byte_index * 8)) & 0xFF]++] = value;
+    }
+    values.swap(buffer);
+  }
+}
+
+template <typename T>
+void sort_unique(std::vector<T>& values) {
+  // Below a few hundred values, the histogram passes of the radix sort do not pay off.
+  if constexpr (std::is_integral_v<T>) {
+    if (values.size() > 256) {
+      radix_sort(values);
+    } else {
+      std::sort(values.begin(), values.end());
+    }
+  } else {
+    std::sort(values.begin(), values.end());
+  }
+  values.erase(std::unique(values.begin(), values.end()), values.end());
+  values.shrink_to_fit();
+}
+
+// Returns the sorted distinct non-NULL values in [begin, end) of a segment.
+template <typename T>
+std::vector<SortKey<T>> build_partial_dictionary(const ValueSegment<T>& segment, const size_t begin, const size_t end) {
+  const auto& values = segment.values();
+  auto partial_dictionary = std::vector<SortKey<T>>{};
+
+  // Strings are expensive to compare, so sorting all of them does not pay off for few distinct values. Instead, they
+  // are first deduplicated with a hash set. Once the set grows beyond a fraction of the rows, sorting is cheaper again
+  // and the set is abandoned.
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto max_hashed_value_count = (end - begin) / 16;
+    auto distinct_values = std::unordered_set<std::string_view>{};
+    auto index = begin;
+    for (; index < end && distinct_values.size() <= max_hashed_value_count; ++index) {
+      if (!segment.is_nullable() || segment.null_values().is_valid(index)) {
+        distinct_values.emplace(values[index]);
+      }
+    }
+
+    if (index == end) {
+      partial_dictionary.reserve(distinct_values.size());
+      for (const auto value : distinct_values) {
+        partial_dictionary.emplace_back(value);
+      }
+      std::sort(partial_dictionary.begin(), partial_dictionary.end());
+      return partial_dictionary;
+    }
+  }
+
+  if (!segment.is_nullable() || segment.null_values().all_valid()) {
+    partial_dictionary.reserve(end - begin);
+    for (auto index = begin; index < end; ++index) {
+      partial_dictionary.push_back(sort_key<T>(values, index));
+    }
+  } else {
+    partial_dictionary.reserve(segment.null_values().count_valid(begin, end));
+    segment.null_values().for_each_valid(begin, end, [&](const size_t index) {
+      partial_dictionary.push_back(sort_key<T>(values, index));
+    });
+  }
+  sort_unique(partial_dictionary);
+  return partial_dictionary;
+}
+
+// Returns the values of a dictionary as a sorted vector. Front-coded dictionaries have to be decoded for this.
+template <typename T>
+std::vector<T> dictionary_values(const typename DictionarySegment<T>::DictionaryType& dictionary) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return dictionary.values();
+  } else {
+    return dictionary;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
-std::shared_ptr<AbstractAttributeVector> get_attribute_vector(size_t vector_size, size_t size) {
-  const auto bits_needed = std::bit_width(vector_size - 1);
-  Assert(vector_size-1 < INVALID_VALUE_ID, "Too many values in dictionary, collision with INVALID_VALUE_ID");
-  Assert(bits_needed <= 32, "Too many values in dictionary, can't use more than 32 bits!");
+std::shared_ptr<AbstractAttributeVector> get_attribute_vector(const size_t max_value_id, const size_t size,
+                                                              const VectorCompressionType vector_compression_type) {
+  Assert(max_value_id < INVALID_VALUE_ID, "Too many values in dictionary, collision with INVALID_VALUE_ID");
+  const auto bits_needed = static_cast<uint8_t>(std::bit_width(max_value_id));
+  if (vector_compression_type == VectorCompressionType::BitPacked) {
+    // Even a dictionary with a single entry needs one bit per row.
+    return std::make_shared<BitPackedVector>(size, std::max(bits_needed, uint8_t{1}));
+  }
+
   if (bits_needed <= 8) {
     return std::make_shared<FixedWidthIntegerVector<uint8_t>>(size);
   } else if (bits_needed <= 16) {
@@ -23,7 +200,9 @@ std::shared_ptr<AbstractAttributeVector> get_attribute_vector(size_t vector_size
 }
 
 template <typename T>
-DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                                        const VectorCompressionType vector_compression_type,
+                                        const size_t max_thread_count) {
   // retrieve value segment
   const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
   Assert(value_segment, "Can't encode abstract segment, because it is no value segment.");
@@ -32,36 +211,168 @@ DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>&
   const auto value_segment_size = value_segment->size();
   _segment_nullable = value_segment->is_nullable();
 
-  // stores value -> id
-  auto unique_values = std::map<T, ValueID>();
+  // Each partition is sorted and deduplicated independently (and in parallel), the partial dictionaries are then
+  // merged. Compared to inserting into a std::map, sorting contiguous values avoids a node allocation per distinct
+  // value and the pointer chasing of the tree.
+  const auto partition_count =
+      std::max((size_t{value_segment_size} + ROWS_PER_PARTITION - 1) / ROWS_PER_PARTITION, size_t{1});
+  const auto partition_begin = [&](const size_t partition_index) {
+    return partition_index * value_segment_size / partition_count;
+  };
 
-  auto last_index = _segment_nullable ? ValueID(1) : ValueID(0);
-  for (auto index = size_t{0}; index < value_segment_size; ++index) {
-    if (!value_segment->is_null(index)) {
-      const auto value = values[index];
-      unique_values.insert(std::pair(value, 0));
+  auto partial_dictionaries = std::vector<std::vector<SortKey<T>>>(partition_count);
+  run_partitioned(partition_count, max_thread_count, [&](const size_t partition_index) {
+    const auto begin = partition_begin(partition_index);
+    const auto end = partition_begin(partition_index + 1);
+    partial_dictionaries[partition_index] = build_partial_dictionary(*value_segment, begin, end);
+  });
+
+  // Partial dictionaries are merged pairwise. As each of them is free of duplicates, std::set_union keeps every value
+  // exactly once.
+  while (partial_dictionaries.size() > 1) {
+    auto merged_dictionaries = std::vector<std::vector<SortKey<T>>>{};
+    for (auto index = size_t{0}; index + 1 < partial_dictionaries.size(); index += 2) {
+      const auto& left = partial_dictionaries[index];
+      const auto& right = partial_dictionaries[index + 1];
+      auto& merged = merged_dictionaries.emplace_back();
+      merged.reserve(left.size() + right.size());
+      std::set_union(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(merged));
     }
+    if (partial_dictionaries.size() % 2 == 1) {
+      merged_dictionaries.push_back(std::move(partial_dictionaries.back()));
+    }
+    partial_dictionaries = std::move(merged_dictionaries);
   }
+  auto sorted_values = std::move(partial_dictionaries.front());
 
-  _dictionary.reserve(unique_values.size());
-  for (auto& [value, id] : unique_values) {
-    _dictionary.push_back(value);
-    id = last_index++;
+  // For integers from a narrow range, a table indexed by the difference to the smallest value replaces the binary
+  // search.
+  const auto first_value_id = _segment_nullable ? size_t{1} : size_t{0};
+  auto dense_value_ids = std::vector<ValueID>{};
+  if constexpr (std::is_integral_v<T>) {
+    if (!sorted_values.empty()) {
+      const auto minimum = static_cast<uint64_t>(sorted_values.front());
+      const auto range = static_cast<uint64_t>(sorted_values.back()) - minimum;
+      if (range < std::max(MIN_DENSE_LOOKUP_RANGE, DENSE_LOOKUP_RANGE_FACTOR * sorted_values.size())) {
+        dense_value_ids.resize(range + 1);
+        for (auto index = size_t{0}; index < sorted_values.size(); ++index) {
+          const auto offset = static_cast<uint64_t>(sorted_values[index]) - minimum;
+          dense_value_ids[offset] = static_cast<ValueID>(first_value_id + index);
+        }
+      }
+    }
   }
-  _dictionary.shrink_to_fit();
 
-  const auto attribute_vector = get_attribute_vector(unique_values.size(), value_segment_size);
+  // The value ids are looked up in parallel. BitPackedVector::set modifies whole words that may span the partition
+  // boundaries, so the attribute vector itself is filled by a single thread afterwards.
+  auto value_ids = std::vector<ValueID>(value_segment_size, null_value_id());
+  const auto value_id_of = [&](const SortKey<T>& value) {
+    if constexpr (std::is_integral_v<T>) {
+      if (!dense_value_ids.empty()) {
+        return dense_value_ids[static_cast<uint64_t>(value) - static_cast<uint64_t>(sorted_values.front())];
+      }
+    }
+    const auto position = std::lower_bound(sorted_values.begin(), sorted_values.end(), value);
+    return static_cast<ValueID>(first_value_id + std::distance(sorted_values.begin(), position));
+  };
+
+  const auto has_nulls = _segment_nullable && !value_segment->null_values().all_valid();
+  run_partitioned(partition_count, max_thread_count, [&](const size_t partition_index) {
+    const auto begin = partition_begin(partition_index);
+    const auto end = partition_begin(partition_index + 1);
+    if (has_nulls) {
+      value_segment->null_values().for_each_valid(begin, end, [&](const size_t index) {
+        value_ids[index] = value_id_of(sort_key<T>(values, index));
+      });
+      return;
+    }
+
+    for (auto index = begin; index < end; ++index) {
+      value_ids[index] = value_id_of(sort_key<T>(values, index));
+    }
+  });
 
+  // The largest value id is the last one assigned, or the NULL value id 0 if there are no non-NULL values.
+  const auto value_id_count = first_value_id + sorted_values.size();
+  const auto max_value_id = value_id_count > 0 ? value_id_count - 1 : 0;
+  const auto attribute_vector = get_attribute_vector(max_value_id, value_segment_size, vector_compression_type);
   for (auto index = size_t{0}; index < value_segment_size; ++index) {
-    if (value_segment->is_null(index)) {
-      attribute_vector->set(index, null_value_id());
+    attribute_vector->set(index, value_ids[index]);
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    _dictionary = std::make_shared<const FrontCodedDictionary>(sorted_values);
+  } else {
+    _dictionary = std::make_shared<const std::vector<T>>(std::move(sorted_values));
+  }
+  _attribute_vector = attribute_vector;
+  _build_search_index();
+}
+
+template <typename T>
+DictionarySegment<T>::DictionarySegment(const DictionarySegment<T>& segment,
+                                        const std::shared_ptr<const DictionaryType>& dictionary,
+                                        const std::shared_ptr<const DictionarySearchIndex<T>>& search_index)
+    : _dictionary{dictionary},
+      _search_index{search_index},
+      _segment_nullable{segment._segment_nullable},
+      _has_shared_dictionary{true} {
+  // Both dictionaries are sorted, so a single merge pass finds the new position of every old value.
+  const auto old_values = dictionary_values<T>(segment.dictionary());
+  const auto new_values = dictionary_values<T>(*dictionary);
+  const auto first_value_id = _segment_nullable ? size_t{1} : size_t{0};
+  auto value_id_mapping = std::vector<ValueID>(first_value_id + old_values.size());
+  if (_segment_nullable) {
+    value_id_mapping[0] = null_value_id();
+  }
+  auto new_index = size_t{0};
+  for (auto old_index = size_t{0}; old_index < old_values.size(); ++old_index) {
+    while (new_index < new_values.size() && new_values[new_index] < old_values[old_index]) {
+      ++new_index;
+    }
+    Assert(new_index < new_values.size() && new_values[new_index] == old_values[old_index],
+           "Dictionary does not contain all values of the segment.");
+    value_id_mapping[first_value_id + old_index] = static_cast<ValueID>(first_value_id + new_index);
+  }
+
+  const auto& old_attribute_vector = *segment.attribute_vector();
+  const auto size = old_attribute_vector.size();
+  const auto is_bit_packed = static_cast<bool>(dynamic_cast<const BitPackedVector*>(&old_attribute_vector));
+  const auto value_id_count = first_value_id + new_values.size();
+  const auto max_value_id = value_id_count > 0 ? value_id_count - 1 : 0;
+  _attribute_vector = get_attribute_vector(
+      max_value_id, size, is_bit_packed ? VectorCompressionType::BitPacked : VectorCompressionType::FixedWidthInteger);
+  for (auto index = size_t{0}; index < size; ++index) {
+    _attribute_vector->set(index, value_id_mapping[old_attribute_vector.get(index)]);
+  }
+
+  if (!_search_index) {
+    if (dictionary == segment._dictionary) {
+      _search_index = segment._search_index;
     } else {
-      const auto dict_value = unique_values[values[index]];
-      attribute_vector->set(index, dict_value);
+      _build_search_index();
     }
   }
-  _attribute_vector = attribute_vector;
-  return;
+}
+
+template <typename T>
+std::shared_ptr<const typename DictionarySegment<T>::DictionaryType> DictionarySegment<T>::merge_dictionaries(
+    const std::shared_ptr<const DictionaryType>& dictionary, const DictionaryType& other_dictionary) {
+  const auto values = dictionary_values<T>(*dictionary);
+  const auto other_values = dictionary_values<T>(other_dictionary);
+  if (std::includes(values.begin(), values.end(), other_values.begin(), other_values.end())) {
+    return dictionary;
+  }
+
+  auto merged_values = std::vector<T>{};
+  merged_values.reserve(values.size() + other_values.size());
+  std::set_union(values.begin(), values.end(), other_values.begin(), other_values.end(),
+                 std::back_inserter(merged_values));
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::make_shared<const FrontCodedDictionary>(merged_values);
+  } else {
+    return std::make_shared<const std::vector<T>>(std::move(merged_values));
+  }
 }
 
 template <typename T>
@@ -90,10 +401,71 @@ std::optional<T> DictionarySegment<T>::get_typed_value(const ChunkOffset chunk_o
 }
 
 template <typename T>
-const std::vector<T>& DictionarySegment<T>::dictionary() const {
+void DictionarySegment<T>::materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out,
+                                             ValidityBitmap* nulls) const {
+  Assert(begin <= end && end <= size(), "Invalid range for DictionarySegment::materialize_range.");
+  if (nulls) {
+    nulls->assign(end - begin, true);
+  }
+
+  // Decoding every value of a front-coded dictionary once is cheaper than decoding a value for each row if there are
+  // more rows than values.
+  auto decoded_dictionary = std::vector<T>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (end - begin >= _dictionary->size()) {
+      decoded_dictionary = _dictionary->values();
+    }
+  }
+
+  const auto null_value_id = this->null_value_id();
+  const auto first_value_id = ValueID::base_type{_segment_nullable ? 1u : 0u};
+  auto value_ids = std::array<ValueID::base_type, MATERIALIZE_BATCH_SIZE>{};
+  for (auto batch_begin = begin; batch_begin < end; batch_begin += MATERIALIZE_BATCH_SIZE) {
+    const auto batch_end = std::min(static_cast<ChunkOffset>(batch_begin + MATERIALIZE_BATCH_SIZE), end);
+    _attribute_vector->decode(batch_begin, batch_end, value_ids.data());
+    for (auto chunk_offset = batch_begin; chunk_offset < batch_end; ++chunk_offset) {
+      const auto value_id = value_ids[chunk_offset - batch_begin];
+      if (value_id == null_value_id) {
+        if (nulls) {
+          nulls->set_valid(chunk_offset - begin, false);
+        }
+        continue;
+      }
+
+      if constexpr (std::is_same_v<T, std::string>) {
+        if (decoded_dictionary.empty()) {
+          out[chunk_offset - begin] = (*_dictionary)[value_id - first_value_id];
+          continue;
+        }
+        out[chunk_offset - begin] = decoded_dictionary[value_id - first_value_id];
+      } else {
+        out[chunk_offset - begin] = (*_dictionary)[value_id - first_value_id];
+      }
+    }
+  }
+}
+
+template <typename T>
+const typename DictionarySegment<T>::DictionaryType& DictionarySegment<T>::dictionary() const {
+  return *_dictionary;
+}
+
+template <typename T>
+const std::shared_ptr<const typename DictionarySegment<T>::DictionaryType>& DictionarySegment<T>::shared_dictionary()
+    const {
   return _dictionary;
 }
 
+template <typename T>
+bool DictionarySegment<T>::has_shared_dictionary() const {
+  return _has_shared_dictionary;
+}
+
+template <typename T>
+const std::shared_ptr<const DictionarySearchIndex<T>>& DictionarySegment<T>::search_index() const {
+  return _search_index;
+}
+
 template <typename T>
 std::shared_ptr<const AbstractAttributeVector> DictionarySegment<T>::attribute_vector() const {
   return _attribute_vector;
@@ -112,11 +484,15 @@ const T DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
 
 template <typename T>
 ValueID DictionarySegment<T>::lower_bound(const T value) const {
-  auto lower_bound_iterator = std::lower_bound(dictionary().begin(), dictionary().end(), value);
-  if (lower_bound_iterator == dictionary().end()) {
-    return INVALID_VALUE_ID;
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _position_to_value_id(_dictionary->lower_bound(value));
+  } else {
+    if (_search_index) {
+      return _position_to_value_id(_search_index->lower_bound(value));
+    }
+    return _position_to_value_id(
+        std::distance(dictionary().begin(), std::lower_bound(dictionary().begin(), dictionary().end(), value)));
   }
-  return static_cast<ValueID>(std::distance(dictionary().begin(), lower_bound_iterator));
 }
 
 template <typename T>
@@ -124,13 +500,35 @@ ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
   return lower_bound(type_cast<T>(value));
 }
 
+template <typename T>
+std::vector<ValueID> DictionarySegment<T>::lower_bound(const std::vector<T>& values) const {
+  auto value_ids = std::vector<ValueID>(values.size());
+  if constexpr (!std::is_same_v<T, std::string>) {
+    if (_search_index) {
+      auto positions = std::vector<size_t>(values.size());
+      _search_index->lower_bound(values.data(), values.size(), positions.data());
+      std::transform(positions.begin(), positions.end(), value_ids.begin(),
+                     [&](const size_t position) { return _position_to_value_id(position); });
+      return value_ids;
+    }
+  }
+
+  std::transform(values.begin(), values.end(), value_ids.begin(),
+                 [&](const T& value) { return lower_bound(value); });
+  return value_ids;
+}
+
 template <typename T>
 ValueID DictionarySegment<T>::upper_bound(const T value) const {
-  auto upper_bound_iterator = std::upper_bound(dictionary().begin(), dictionary().end(), value);
-  if (upper_bound_iterator == dictionary().end()) {
-    return INVALID_VALUE_ID;
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _position_to_value_id(_dictionary->upper_bound(value));
+  } else {
+    if (_search_index) {
+      return _position_to_value_id(_search_index->upper_bound(value));
+    }
+    return _position_to_value_id(
+        std::distance(dictionary().begin(), std::upper_bound(dictionary().begin(), dictionary().end(), value)));
   }
-  return static_cast<ValueID>(std::distance(dictionary().begin(), upper_bound_iterator));
 }
 
 template <typename T>
@@ -138,6 +536,21 @@ ValueID DictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
   return upper_bound(type_cast<T>(value));
 }
 
+template <typename T>
+ValueID DictionarySegment<T>::find(const T value) const {
+  if constexpr (!std::is_same_v<T, std::string>) {
+    if (_search_index) {
+      return _position_to_value_id(_search_index->find(value));
+    }
+  }
+
+  const auto position = lower_bound(value);
+  if (position == INVALID_VALUE_ID || !(dictionary()[position] == value)) {
+    return INVALID_VALUE_ID;
+  }
+  return position;
+}
+
 template <typename T>
 ChunkOffset DictionarySegment<T>::unique_values_count() const {
   return dictionary().size();
@@ -150,9 +563,32 @@ ChunkOffset DictionarySegment<T>::size() const {
 
 template <typename T>
 size_t DictionarySegment<T>::estimate_memory_usage() const {
-  auto dict_size = sizeof(T) * dictionary().size();
-  auto att_vec_size = attribute_vector()->width() * attribute_vector()->size();
-  return dict_size + att_vec_size;
+  auto dict_size = size_t{0};
+  if constexpr (std::is_same_v<T, std::string>) {
+    dict_size = _dictionary->estimate_memory_usage();
+  } else {
+    dict_size = sizeof(T) * _dictionary->size();
+  }
+  auto att_vec_size = attribute_vector()->estimate_memory_usage();
+  auto search_index_size = _search_index ? _search_index->estimate_memory_usage() : size_t{0};
+  return dict_size + att_vec_size + search_index_size;
+}
+
+template <typename T>
+void DictionarySegment<T>::_build_search_index() {
+  if constexpr (!std::is_same_v<T, std::string>) {
+    if (_dictionary->size() >= DictionarySearchIndex<T>::MIN_DICTIONARY_SIZE) {
+      _search_index = std::make_shared<const DictionarySearchIndex<T>>(*_dictionary);
+    }
+  }
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::_position_to_value_id(const size_t position) const {
+  if (position == _dictionary->size()) {
+    return INVALID_VALUE_ID;
+  }
+  return static_cast<ValueID>(position);
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySegment);
@@ -1,19 +1,46 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "dictionary_search_index.hpp"
+#include "front_coded_dictionary.hpp"
 
 namespace opossum {
 
 class AbstractAttributeVector;
+class ValidityBitmap;
 
 // Dictionary is a specific segment type that stores all its values in a vector
 template <typename T>
 class DictionarySegment : public AbstractSegment {
  public:
+  // Strings are stored front-coded in a contiguous buffer, all other types in a sorted vector.
+  using DictionaryType = std::conditional_t<std::is_same_v<T, std::string>, FrontCodedDictionary, std::vector<T>>;
+
+  /**
+   * Creates a Dictionary segment from a given value segment. The vector compression type determines which kind of
+   * attribute vector is used to store the value ids. Large segments are encoded by up to max_thread_count threads, or
+   * by up to one thread per core if it is 0. Callers that encode several segments at once should divide the cores
+   * among them.
+   */
+  explicit DictionarySegment(
+      const std::shared_ptr<AbstractSegment>& abstract_segment,
+      const VectorCompressionType vector_compression_type = VectorCompressionType::FixedWidthInteger,
+      const size_t max_thread_count = 0);
+
   /**
-   * Creates a Dictionary segment from a given value segment.
+   * Re-encodes a DictionarySegment against a dictionary that contains all of its values, usually the dictionary that
+   * is shared by all segments of a column (see SegmentEncodingSpec::use_shared_dictionary). The value ids are
+   * translated with a mapping from the old to the new dictionary, so the values of the rows are not compared again.
+   * The kind of attribute vector is kept, but its width grows if the new dictionary needs more bits. If the search
+   * index of the new dictionary is given, it is shared instead of built again.
    */
-  explicit DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+  DictionarySegment(const DictionarySegment<T>& segment, const std::shared_ptr<const DictionaryType>& dictionary,
+                    const std::shared_ptr<const DictionarySearchIndex<T>>& search_index = nullptr);
+
+  // Returns a dictionary with the values of both dictionaries. If the first dictionary already contains all values of
+  // the second one, it is returned itself, so that segments referencing it do not have to be re-encoded.
+  static std::shared_ptr<const DictionaryType> merge_dictionaries(
+      const std::shared_ptr<const DictionaryType>& dictionary, const DictionaryType& other_dictionary);
 
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
@@ -24,8 +51,22 @@ class DictionarySegment : public AbstractSegment {
   // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
   std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
 
+  // Writes the values of the rows [begin, end) to out, which has to hold end - begin entries. The value ids are decoded
+  // in batches. If nulls is given, it is refilled with the validity of the rows. The value of a NULL row is undefined.
+  void materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out, ValidityBitmap* nulls) const;
+
   // Returns an underlying dictionary.
-  const std::vector<T>& dictionary() const;
+  const DictionaryType& dictionary() const;
+
+  // Returns the dictionary as a shared pointer, so that other segments can be encoded against it.
+  const std::shared_ptr<const DictionaryType>& shared_dictionary() const;
+
+  // Returns whether the dictionary is shared by all DictionarySegments of the column. If so, equal value ids in
+  // different chunks of the column refer to the same value.
+  bool has_shared_dictionary() const;
+
+  // Returns the index that speeds up searching the dictionary, or nullptr if the dictionary is small or stores strings.
+  const std::shared_ptr<const DictionarySearchIndex<T>>& search_index() const;
 
   // Returns an underlying data structure.
   std::shared_ptr<const AbstractAttributeVector> attribute_vector() const;
@@ -43,6 +84,10 @@ class DictionarySegment : public AbstractSegment {
   // Same as lower_bound(T), but accepts an AllTypeVariant.
   ValueID lower_bound(const AllTypeVariant& value) const;
 
+  // Same as lower_bound(T) for many search values at once, e.g., the keys of a join. For large dictionaries, the
+  // searches are interleaved so that their cache misses overlap.
+  std::vector<ValueID> lower_bound(const std::vector<T>& values) const;
+
   // Returns the first value ID that refers to a value > the search value. Returns INVALID_VALUE_ID if all values are
   // smaller than or equal to the search value.
   ValueID upper_bound(const T value) const;
@@ -50,19 +95,32 @@ class DictionarySegment : public AbstractSegment {
   // Same as upper_bound(T), but accepts an AllTypeVariant.
   ValueID upper_bound(const AllTypeVariant& value) const;
 
+  // Returns the value ID of the search value, or INVALID_VALUE_ID if the dictionary does not contain it. Like
+  // lower_bound, the value ID is the position in the dictionary. Large dictionaries are probed with a hash table.
+  ValueID find(const T value) const;
+
   // Returns the number of unique_values (dictionary entries).
   ChunkOffset unique_values_count() const;
 
   // Returns the number of entries.
   ChunkOffset size() const override;
 
-  // Returns the calculated memory usage.
+  // Returns the calculated memory usage. A shared dictionary and its search index are included completely, even
+  // though all segments of the column reference the same ones.
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _dictionary;
+  // Builds the search index if the dictionary is large enough.
+  void _build_search_index();
+
+  // Converts a position in the dictionary, as returned by the search functions, to a ValueID.
+  ValueID _position_to_value_id(const size_t position) const;
+
+  std::shared_ptr<const DictionaryType> _dictionary;
+  std::shared_ptr<const DictionarySearchIndex<T>> _search_index;
   std::shared_ptr<AbstractAttributeVector> _attribute_vector;
   bool _segment_nullable;
+  bool _has_shared_dictionary{false};
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(DictionarySegment);
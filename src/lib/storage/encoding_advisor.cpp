@@ -0,0 +1,248 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <unordered_map>
+
+#include "alp_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "german_string.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Segments with up to SAMPLE_WINDOW_COUNT * SAMPLE_WINDOW_SIZE rows are analyzed completely.
+constexpr auto SAMPLE_WINDOW_COUNT = size_t{16};
+constexpr auto SAMPLE_WINDOW_SIZE = size_t{256};
+
+// A slower encoding has to save at least this fraction of the memory of the best encoding so far.
+constexpr auto MIN_SAVINGS = 0.1;
+
+// FSST typically halves the size of text values (see FSSTSegment).
+constexpr auto ESTIMATED_FSST_COMPRESSION_RATIO = 2.0;
+
+template <typename T>
+struct SampleStatistics {
+  size_t row_count{0};
+  size_t null_count{0};
+  size_t distinct_count{0};
+  size_t run_count{0};
+  std::optional<T> min_value{};
+  std::optional<T> max_value{};
+  bool is_sorted{true};
+  // Largest difference between two consecutive non-NULL values, only maintained for sorted integral values.
+  uint64_t max_delta{0};
+  double average_string_length{0.0};
+  std::vector<T> sampled_values{};
+};
+
+template <typename T>
+SampleStatistics<T> analyze_sample(const ValueSegment<T>& segment) {
+  auto statistics = SampleStatistics<T>{};
+  const auto& values = segment.values();
+  const auto row_count = size_t{segment.size()};
+  statistics.row_count = row_count;
+  if (row_count == 0) {
+    return statistics;
+  }
+
+  const auto is_sampled = row_count > SAMPLE_WINDOW_COUNT * SAMPLE_WINDOW_SIZE;
+  const auto window_count = is_sampled ? SAMPLE_WINDOW_COUNT : size_t{1};
+  const auto window_size = is_sampled ? SAMPLE_WINDOW_SIZE : row_count;
+
+  auto frequencies = std::unordered_map<T, size_t>{};
+  auto sampled_null_count = size_t{0};
+  auto compared_pair_count = size_t{0};
+  auto run_boundary_count = size_t{0};
+  auto total_string_length = size_t{0};
+  auto previous_value = std::optional<T>{};
+  for (auto window_index = size_t{0}; window_index < window_count; ++window_index) {
+    const auto window_begin = is_sampled ? window_index * (row_count - window_size) / (window_count - 1) : size_t{0};
+    for (auto index = window_begin; index < window_begin + window_size; ++index) {
+      const auto chunk_offset = static_cast<ChunkOffset>(index);
+      const auto is_null = segment.is_null(chunk_offset);
+      if (index > window_begin) {
+        ++compared_pair_count;
+        const auto previous_is_null = segment.is_null(chunk_offset - 1);
+        if (is_null != previous_is_null || (!is_null && values[index] != values[index - 1])) {
+          ++run_boundary_count;
+        }
+      }
+
+      if (is_null) {
+        ++sampled_null_count;
+        continue;
+      }
+
+      const auto value = T{values[index]};
+      ++frequencies[value];
+      statistics.sampled_values.push_back(value);
+      if (!statistics.min_value || value < *statistics.min_value) {
+        statistics.min_value = value;
+      }
+      if (!statistics.max_value || value > *statistics.max_value) {
+        statistics.max_value = value;
+      }
+      if constexpr (std::is_same_v<T, std::string>) {
+        total_string_length += value.size();
+      }
+
+      if (previous_value) {
+        if (value < *previous_value) {
+          statistics.is_sorted = false;
+        } else if constexpr (std::is_integral_v<T>) {
+          const auto delta = static_cast<uint64_t>(value) - static_cast<uint64_t>(*previous_value);
+          statistics.max_delta = std::max(statistics.max_delta, delta);
+        }
+      }
+      previous_value = value;
+    }
+  }
+
+  const auto sampled_row_count = window_count * window_size;
+  const auto sampled_value_count = statistics.sampled_values.size();
+  statistics.null_count = sampled_null_count * row_count / sampled_row_count;
+  statistics.run_count =
+      compared_pair_count > 0 ? 1 + run_boundary_count * (row_count - 1) / compared_pair_count : row_count;
+  if (sampled_value_count > 0) {
+    statistics.average_string_length = static_cast<double>(total_string_length) / sampled_value_count;
+  }
+
+  // Values that occur once in the sample stand for many unseen values, those that occur repeatedly are likely to have
+  // been seen already. This is the Guaranteed-Error Estimator (GEE) by Charikar et al. GEE underestimates unique
+  // columns, so a sample without any repeated value is taken as a sign that all values are distinct.
+  const auto sampled_distinct_count = frequencies.size();
+  if (!is_sampled || sampled_value_count == 0) {
+    statistics.distinct_count = sampled_distinct_count;
+  } else {
+    const auto singleton_count = static_cast<size_t>(
+        std::count_if(frequencies.begin(), frequencies.end(), [](const auto& entry) { return entry.second == 1; }));
+    const auto value_count = row_count - statistics.null_count;
+    const auto scale = std::sqrt(static_cast<double>(value_count) / static_cast<double>(sampled_value_count));
+    const auto estimate = singleton_count == sampled_value_count
+                              ? value_count
+                              : static_cast<size_t>(scale * singleton_count) + sampled_distinct_count - singleton_count;
+    statistics.distinct_count = std::clamp(estimate, sampled_distinct_count, std::max(value_count, size_t{1}));
+  }
+
+  return statistics;
+}
+
+template <typename T>
+SegmentEncodingSpec choose_encoding(const ValueSegment<T>& segment, const DataType data_type) {
+  const auto statistics = analyze_sample(segment);
+  const auto row_count = static_cast<double>(statistics.row_count);
+  const auto value_count = static_cast<double>(statistics.row_count - statistics.null_count);
+  const auto null_vector_size = segment.is_nullable() ? row_count / 8 : 0.0;
+
+  // Value segments store strings in a StringVector: a 16 byte GermanString per value, plus the characters in the
+  // vector's pages for values that are too long to be inlined. Dictionaries store them contiguously (front coded).
+  auto stored_value_size = static_cast<double>(sizeof(T));
+  auto dictionary_value_size = static_cast<double>(sizeof(T));
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto is_inlined = statistics.average_string_length <= GermanString::INLINE_CAPACITY;
+    stored_value_size = sizeof(GermanString) + (is_inlined ? 0.0 : statistics.average_string_length);
+    dictionary_value_size = statistics.average_string_length + 1;
+  }
+
+  auto best_spec = SegmentEncodingSpec{EncodingType::Unencoded};
+  auto best_size = row_count * stored_value_size + null_vector_size;
+  const auto consider = [&](const SegmentEncodingSpec& spec, const double size) {
+    if (encoding_supports_data_type(spec.encoding_type, data_type) && size < best_size * (1 - MIN_SAVINGS)) {
+      best_spec = spec;
+      best_size = size;
+    }
+  };
+
+  // Fixed-width value ids are faster to access, so they are only replaced by bit-packed ones that save a quarter.
+  const auto value_id_count = statistics.distinct_count + (segment.is_nullable() ? 1 : 0);
+  const auto value_id_bits = std::max(static_cast<int>(std::bit_width(std::max(value_id_count, size_t{1}) - 1)), 1);
+  const auto fixed_width_bits = value_id_bits <= 8 ? 8 : value_id_bits <= 16 ? 16 : 32;
+  const auto vector_compression_type = value_id_bits * 4 <= fixed_width_bits * 3
+                                           ? VectorCompressionType::BitPacked
+                                           : VectorCompressionType::FixedWidthInteger;
+  const auto attribute_vector_bits = vector_compression_type == VectorCompressionType::BitPacked
+                                         ? value_id_bits
+                                         : fixed_width_bits;
+  consider({EncodingType::Dictionary, vector_compression_type},
+           static_cast<double>(statistics.distinct_count) * dictionary_value_size +
+               row_count * attribute_vector_bits / 8);
+
+  if constexpr (std::is_integral_v<T>) {
+    if (statistics.min_value) {
+      const auto range = static_cast<uint64_t>(*statistics.max_value) - static_cast<uint64_t>(*statistics.min_value);
+      const auto block_count = std::ceil(row_count / FrameOfReferenceSegment<int64_t>::BLOCK_SIZE);
+      const auto block_overhead = block_count * (sizeof(T) + sizeof(uint8_t) + sizeof(size_t));
+      consider({EncodingType::FrameOfReference},
+               row_count * std::bit_width(range) / 8 + block_overhead + null_vector_size);
+    }
+  }
+
+  consider({EncodingType::RunLength},
+           static_cast<double>(statistics.run_count) * (stored_value_size + sizeof(ChunkOffset) + 1.0 / 8));
+
+  // Delta encoding makes random accesses linear in the block size, so it comes after run-length encoding. The sample
+  // may miss unsorted rows, but the segment has to be sorted completely.
+  if constexpr (std::is_integral_v<T>) {
+    if (statistics.min_value && statistics.is_sorted) {
+      const auto block_count = std::ceil(row_count / FrameOfReferenceSegment<int64_t>::BLOCK_SIZE);
+      const auto block_overhead = block_count * (sizeof(T) + sizeof(uint8_t) + sizeof(size_t));
+      const auto size = row_count * std::bit_width(statistics.max_delta) / 8 + block_overhead + null_vector_size;
+      if (size < best_size * (1 - MIN_SAVINGS)) {
+        const auto& values = segment.values();
+        auto previous_value = std::optional<T>{};
+        auto is_sorted = true;
+        for (auto index = ChunkOffset{0}; is_sorted && index < segment.size(); ++index) {
+          if (!segment.is_null(index)) {
+            is_sorted = !previous_value || values[index] >= *previous_value;
+            previous_value = values[index];
+          }
+        }
+
+        if (is_sorted) {
+          consider({EncodingType::FrameOfReference, VectorCompressionType::FixedWidthInteger, true}, size);
+        }
+      }
+    }
+  }
+
+  if constexpr (std::is_floating_point_v<T>) {
+    if (!statistics.sampled_values.empty()) {
+      // ALP's exponents depend on the actual digits of the values, so the sample is encoded on a trial basis.
+      const auto sample_segment = std::make_shared<ValueSegment<T>>(std::vector<T>(statistics.sampled_values));
+      const auto alp_segment = ALPSegment<T>{sample_segment};
+      const auto scale = value_count / static_cast<double>(statistics.sampled_values.size());
+      const auto alp_size = static_cast<double>(alp_segment.estimate_memory_usage()) * scale;
+      consider({EncodingType::ALP}, alp_size + null_vector_size);
+    }
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    consider({EncodingType::FSST}, row_count * (statistics.average_string_length / ESTIMATED_FSST_COMPRESSION_RATIO +
+                                                sizeof(uint32_t)) + null_vector_size);
+  }
+
+  return best_spec;
+}
+
+}  // namespace
+
+namespace opossum {
+
+SegmentEncodingSpec choose_segment_encoding(const std::shared_ptr<AbstractSegment>& segment, const DataType data_type) {
+  auto spec = SegmentEncodingSpec{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+    Assert(value_segment, "The encoding advisor can only analyze value segments.");
+    spec = choose_encoding(*value_segment, data_type);
+  });
+  return spec;
+}
+
+}  // namespace opossum
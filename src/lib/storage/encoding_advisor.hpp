@@ -0,0 +1,19 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "segment_encoding.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Returns the spec with which the given ValueSegment of the given data type should be encoded. The advisor samples
+// windows of consecutive rows and derives the distinct count, the run count, the value range, and whether the values
+// are sorted. From these, it estimates the size of each encoding that supports the data type.
+// Encodings are considered from the fastest to the slowest to decode, and a slower encoding is only chosen if it is
+// clearly smaller than the best one so far. The result is never EncodingType::Auto.
+SegmentEncodingSpec choose_segment_encoding(const std::shared_ptr<AbstractSegment>& segment, const DataType data_type);
+
+}  // namespace opossum
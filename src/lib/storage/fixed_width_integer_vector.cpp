@@ -1,4 +1,11 @@
 #include "fixed_width_integer_vector.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -8,7 +15,9 @@ FixedWidthIntegerVector<uintX_t>::FixedWidthIntegerVector(size_t size) : _values
 
 template <typename uintX_t>
 ValueID FixedWidthIntegerVector<uintX_t>::get(const size_t index) const {
-  return ValueID{_values.at(index)};
+  DebugAssert(index < size(), "index " + std::to_string(index) +
+                                  " out of bounds for FixedWidthIntegerVector with size " + std::to_string(size()));
+  return ValueID{_values[index]};
 }
 
 template <typename uintX_t>
@@ -23,11 +32,47 @@ size_t FixedWidthIntegerVector<uintX_t>::size() const {
   return _values.size();
 }
 
+template <typename uintX_t>
+void FixedWidthIntegerVector<uintX_t>::decode(const size_t begin, const size_t end, ValueID::base_type* out) const {
+  Assert(begin <= end && end <= _values.size(), "Invalid range for FixedWidthIntegerVector::decode.");
+  auto index = begin;
+
+#if defined(__AVX2__)
+  // Each iteration loads 16 bytes and zero-extends them to 32 bits per value id.
+  if constexpr (sizeof(uintX_t) == 1) {
+    for (; index + 16 <= end; index += 16) {
+      const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_values.data() + index));
+      auto* const target = reinterpret_cast<__m256i*>(out + (index - begin));
+      _mm256_storeu_si256(target, _mm256_cvtepu8_epi32(bytes));
+      _mm256_storeu_si256(target + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)));
+    }
+  } else if constexpr (sizeof(uintX_t) == 2) {
+    for (; index + 8 <= end; index += 8) {
+      const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_values.data() + index));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + (index - begin)), _mm256_cvtepu16_epi32(values));
+    }
+  }
+#endif
+
+  // Without AVX2, the compiler vectorizes the widening copy itself with the instruction set it targets.
+  std::copy(_values.begin() + index, _values.begin() + end, out + (index - begin));
+}
+
 template <typename uintX_t>
 AttributeVectorWidth FixedWidthIntegerVector<uintX_t>::width() const {
   return sizeof(uintX_t);
 }
 
+template <typename uintX_t>
+size_t FixedWidthIntegerVector<uintX_t>::estimate_memory_usage() const {
+  return sizeof(uintX_t) * _values.size();
+}
+
+template <typename uintX_t>
+const std::vector<uintX_t>& FixedWidthIntegerVector<uintX_t>::values() const {
+  return _values;
+}
+
 template class FixedWidthIntegerVector<uint8_t>;
 template class FixedWidthIntegerVector<uint16_t>;
 template class FixedWidthIntegerVector<uint32_t>;
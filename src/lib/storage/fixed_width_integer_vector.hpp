@@ -6,7 +6,7 @@
 namespace opossum {
 
 template <typename uintX_t>
-class FixedWidthIntegerVector : public AbstractAttributeVector {
+class FixedWidthIntegerVector final : public AbstractAttributeVector {
  public:
   explicit FixedWidthIntegerVector(size_t size);
 
@@ -19,9 +19,19 @@ class FixedWidthIntegerVector : public AbstractAttributeVector {
   // Returns the number of values.
   size_t size() const override;
 
+  // Widens the value ids in [begin, end) to 32 bits. If the library is compiled with AVX2 support, 8-bit and 16-bit
+  // value ids are widened sixteen or eight at a time.
+  void decode(const size_t begin, const size_t end, ValueID::base_type* out) const override;
+
   // Returns the width of biggest value id in bytes.
   AttributeVectorWidth width() const override;
 
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const override;
+
+  // Returns the stored value ids, e.g., for iterating over them without a virtual call per value.
+  const std::vector<uintX_t>& values() const;
+
  private:
   std::vector<uintX_t> _values;
 };
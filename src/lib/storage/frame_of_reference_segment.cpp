@@ -0,0 +1,249 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                                                    const bool use_delta_encoding)
+    : _size{0}, _delta_encoded{use_delta_encoding} {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Can't encode abstract segment, because it is no value segment.");
+
+  const auto& values = value_segment->values();
+  _size = value_segment->size();
+  if (value_segment->is_nullable()) {
+    _validity = value_segment->null_values();
+  }
+
+  const auto is_null = [&](const ChunkOffset index) {
+    return !_validity.empty() && _validity.is_null(index);
+  };
+
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima.reserve(block_count);
+  _block_bit_widths.reserve(block_count);
+  _block_word_offsets.reserve(block_count);
+
+  // Offsets of the current block, i.e., differences to the block minimum or to the previous value. NULLs are stored as
+  // an offset of zero so that they neither widen the block nor disturb the running sum in delta mode.
+  auto offsets = std::vector<UnsignedT>(BLOCK_SIZE);
+  auto previous_value = std::optional<T>{};
+  for (auto block_begin = ChunkOffset{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+
+    // The reference is the first non-NULL value of the block in delta mode and the block minimum otherwise.
+    auto reference = T{0};
+    auto has_reference = false;
+    for (auto index = block_begin; index < block_end; ++index) {
+      if (!is_null(index) && (!has_reference || (!_delta_encoded && values[index] < reference))) {
+        reference = values[index];
+        has_reference = true;
+      }
+    }
+
+    auto max_offset = UnsignedT{0};
+    auto running_value = reference;
+    for (auto index = block_begin; index < block_end; ++index) {
+      auto& offset = offsets[index - block_begin];
+      if (is_null(index)) {
+        offset = 0;
+        continue;
+      }
+
+      if (_delta_encoded) {
+        Assert(values[index] >= running_value && (!previous_value || values[index] >= *previous_value),
+               "Delta encoding requires the values to be sorted in ascending order.");
+        offset = static_cast<UnsignedT>(values[index]) - static_cast<UnsignedT>(running_value);
+        running_value = values[index];
+        previous_value = values[index];
+      } else {
+        offset = static_cast<UnsignedT>(values[index]) - static_cast<UnsignedT>(reference);
+      }
+      max_offset = std::max(max_offset, offset);
+    }
+
+    // Append the offsets to the packed words. A bit width of zero (i.e., a constant block) does not need any words.
+    const auto bit_width = static_cast<uint8_t>(std::bit_width(max_offset));
+    const auto word_offset = _packed_offsets.size();
+    const auto block_length = block_end - block_begin;
+    _packed_offsets.resize(word_offset + (size_t{block_length} * bit_width + 63) / 64);
+    for (auto index_in_block = ChunkOffset{0}; bit_width > 0 && index_in_block < block_length; ++index_in_block) {
+      const auto bit_position = size_t{index_in_block} * bit_width;
+      const auto word_index = word_offset + bit_position / 64;
+      const auto shift = bit_position % 64;
+      const auto offset = static_cast<uint64_t>(offsets[index_in_block]);
+      _packed_offsets[word_index] |= offset << shift;
+      if (shift + bit_width > 64) {
+        _packed_offsets[word_index + 1] |= offset >> (64 - shift);
+      }
+    }
+
+    _block_minima.push_back(reference);
+    _block_bit_widths.push_back(bit_width);
+    _block_word_offsets.push_back(word_offset);
+  }
+
+  // One word of padding allows _read_offset to always read two consecutive words.
+  _packed_offsets.push_back(0);
+  _packed_offsets.shrink_to_fit();
+}
+
+template <typename T>
+typename FrameOfReferenceSegment<T>::UnsignedT FrameOfReferenceSegment<T>::_read_offset(
+    const size_t block_index, const ChunkOffset index_in_block) const {
+  const auto bit_width = _block_bit_widths[block_index];
+  if (bit_width == 0) {
+    return 0;
+  }
+
+  const auto bit_position = size_t{index_in_block} * bit_width;
+  const auto word_index = _block_word_offsets[block_index] + bit_position / 64;
+  const auto shift = bit_position % 64;
+  auto offset = _packed_offsets[word_index] >> shift;
+  if (shift + bit_width > 64) {
+    offset |= _packed_offsets[word_index + 1] << (64 - shift);
+  }
+  if (bit_width < 64) {
+    offset &= (uint64_t{1} << bit_width) - 1;
+  }
+  return static_cast<UnsignedT>(offset);
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::_decode_block(const size_t block_index, T* out) const {
+  const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+  const auto block_length = std::min(BLOCK_SIZE, _size - block_begin);
+  const auto reference = static_cast<UnsignedT>(_block_minima[block_index]);
+
+  if (_delta_encoded) {
+    auto running_value = reference;
+    for (auto index_in_block = ChunkOffset{0}; index_in_block < block_length; ++index_in_block) {
+      running_value += _read_offset(block_index, index_in_block);
+      out[index_in_block] = static_cast<T>(running_value);
+    }
+  } else {
+    for (auto index_in_block = ChunkOffset{0}; index_in_block < block_length; ++index_in_block) {
+      out[index_in_block] = static_cast<T>(reference + _read_offset(block_index, index_in_block));
+    }
+  }
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  if (return_value) {
+    return *return_value;
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return !_validity.empty() && _validity.is_null(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  Assert(return_value.has_value(), "Value at position: " + std::to_string(chunk_offset) + " is NULL!");
+  return *return_value;
+}
+
+template <typename T>
+std::optional<T> FrameOfReferenceSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _size, "Chunk offset " + std::to_string(chunk_offset) + " is out of range.");
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  const auto index_in_block = chunk_offset % BLOCK_SIZE;
+  auto value = static_cast<UnsignedT>(_block_minima[block_index]);
+  if (_delta_encoded) {
+    for (auto index = ChunkOffset{0}; index <= index_in_block; ++index) {
+      value += _read_offset(block_index, index);
+    }
+  } else {
+    value += _read_offset(block_index, index_in_block);
+  }
+  return static_cast<T>(value);
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode(const ChunkOffset begin, const ChunkOffset end, T* out) const {
+  Assert(begin <= end && end <= _size, "Invalid range for FrameOfReferenceSegment::decode.");
+  if (begin == end) {
+    return;
+  }
+
+  auto block_buffer = std::vector<T>{};
+  const auto first_block = begin / BLOCK_SIZE;
+  const auto last_block = (end - 1) / BLOCK_SIZE;
+  for (auto block_index = first_block; block_index <= last_block; ++block_index) {
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+
+    // Full blocks are decoded directly into the output, partial ones (at most two) go through a buffer.
+    if (block_begin >= begin && block_end <= end) {
+      _decode_block(block_index, out + (block_begin - begin));
+      continue;
+    }
+
+    block_buffer.resize(BLOCK_SIZE);
+    _decode_block(block_index, block_buffer.data());
+    const auto copy_begin = std::max(begin, block_begin);
+    const auto copy_end = std::min(end, block_end);
+    std::copy(block_buffer.begin() + (copy_begin - block_begin), block_buffer.begin() + (copy_end - block_begin),
+              out + (copy_begin - begin));
+  }
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_delta_encoded() const {
+  return _delta_encoded;
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+const std::vector<uint8_t>& FrameOfReferenceSegment<T>::block_bit_widths() const {
+  return _block_bit_widths;
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out,
+                                                   ValidityBitmap* nulls) const {
+  decode(begin, end, out);
+  if (nulls) {
+    if (_validity.empty()) {
+      nulls->assign(end - begin, true);
+    } else {
+      nulls->assign(_validity, begin, end);
+    }
+  }
+}
+
+template <typename T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return _block_minima.size() * (sizeof(T) + sizeof(uint8_t) + sizeof(size_t)) +
+         _packed_offsets.size() * sizeof(uint64_t) + _validity.estimate_memory_usage();
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+#include "validity_bitmap.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is a segment type for integer columns. The values are split into blocks of BLOCK_SIZE rows.
+// Each block stores its minimum and the offsets of all values to that minimum, bit-packed with as many bits as the
+// largest offset of the block requires. For sorted data (e.g., monotonically increasing ids or timestamps), the delta
+// mode stores the differences between consecutive values instead, which are usually even smaller. Random access in
+// delta mode needs to sum up the deltas from the beginning of the block, so operators should prefer decode().
+template <typename T>
+class FrameOfReferenceSegment : public AbstractSegment {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  // Creates a FrameOfReferenceSegment from a given value segment. Delta encoding requires the non-NULL values to be
+  // sorted in ascending order.
+  explicit FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                                   const bool use_delta_encoding = false);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Decodes the values in [begin, end) into the buffer pointed to by out, which has to hold end - begin entries. The
+  // values are decoded block by block. The content of NULL positions is undefined.
+  void decode(const ChunkOffset begin, const ChunkOffset end, T* out) const;
+
+  // Same as decode, but additionally refills nulls (if given) with the validity of the rows.
+  void materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out, ValidityBitmap* nulls) const;
+
+  // Returns whether consecutive differences are stored instead of offsets to the block minimum.
+  bool is_delta_encoded() const;
+
+  // Returns the minimum (or, in delta mode, the first value) of each block.
+  const std::vector<T>& block_minima() const;
+
+  // Returns the number of bits used for the offsets of each block.
+  const std::vector<uint8_t>& block_bit_widths() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  // Reads the offset with the given index from the bit-packed representation of a block.
+  UnsignedT _read_offset(const size_t block_index, const ChunkOffset index_in_block) const;
+
+  // Decodes all values of a block into out.
+  void _decode_block(const size_t block_index, T* out) const;
+
+  std::vector<T> _block_minima;
+  std::vector<uint8_t> _block_bit_widths;
+  // Index of the first word of each block in _packed_offsets.
+  std::vector<size_t> _block_word_offsets;
+  std::vector<uint64_t> _packed_offsets;
+  // Empty if the segment is not nullable.
+  ValidityBitmap _validity;
+  ChunkOffset _size;
+  bool _delta_encoded;
+};
+
+extern template class FrameOfReferenceSegment<int32_t>;
+extern template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
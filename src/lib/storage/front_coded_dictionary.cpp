@@ -0,0 +1,179 @@
+#include "front_coded_dictionary.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Lengths are stored as variable-length integers (LEB128), so that most of them need a single byte.
+void append_varint(std::vector<char>& data, size_t value) {
+  while (value >= 0x80) {
+    data.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  data.push_back(static_cast<char>(value));
+}
+
+size_t read_varint(const char*& position) {
+  auto value = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*position++);
+    value |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return value;
+    }
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+FrontCodedDictionary::FrontCodedDictionary(const std::vector<std::string>& sorted_values)
+    : FrontCodedDictionary(std::vector<GermanString>(sorted_values.begin(), sorted_values.end())) {}
+
+FrontCodedDictionary::FrontCodedDictionary(const std::vector<GermanString>& sorted_values)
+    : _size(sorted_values.size()) {
+  DebugAssert(std::adjacent_find(sorted_values.begin(), sorted_values.end(), std::greater_equal<>{}) ==
+                  sorted_values.end(),
+              "Values of a FrontCodedDictionary have to be sorted and unique.");
+
+  _block_offsets.reserve((_size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  for (auto index = size_t{0}; index < _size; ++index) {
+    const auto value = sorted_values[index].view();
+    if (index % BLOCK_SIZE == 0) {
+      Assert(_data.size() <= std::numeric_limits<uint32_t>::max(), "FrontCodedDictionary exceeds 4 GB.");
+      _block_offsets.push_back(static_cast<uint32_t>(_data.size()));
+      append_varint(_data, value.size());
+      _data.insert(_data.end(), value.begin(), value.end());
+      continue;
+    }
+
+    const auto previous_value = sorted_values[index - 1].view();
+    const auto [mismatch, _] = std::mismatch(value.begin(), value.end(), previous_value.begin(), previous_value.end());
+    const auto prefix_length = static_cast<size_t>(std::distance(value.begin(), mismatch));
+    append_varint(_data, prefix_length);
+    append_varint(_data, value.size() - prefix_length);
+    _data.insert(_data.end(), mismatch, value.end());
+  }
+
+  _data.shrink_to_fit();
+
+  // The headers are created after shrinking, which may have moved the buffer.
+  _block_headers.reserve(_block_offsets.size());
+  for (const auto block_offset : _block_offsets) {
+    const auto* position = _data.data() + block_offset;
+    const auto length = read_varint(position);
+    _block_headers.emplace_back(std::string_view{position, length});
+  }
+}
+
+template <typename Functor>
+size_t FrontCodedDictionary::_scan_block(const size_t block_index, const Functor& functor) const {
+  const auto block_length = std::min(BLOCK_SIZE, _size - block_index * BLOCK_SIZE);
+  const auto* position = _data.data() + _block_offsets[block_index];
+
+  // The buffer holds the current value. Each entry keeps a prefix of its predecessor and appends its suffix.
+  auto value = std::string{};
+  const auto header_length = read_varint(position);
+  value.assign(position, header_length);
+  position += header_length;
+  if (functor(value)) {
+    return 0;
+  }
+
+  for (auto index_in_block = size_t{1}; index_in_block < block_length; ++index_in_block) {
+    const auto prefix_length = read_varint(position);
+    const auto suffix_length = read_varint(position);
+    value.resize(prefix_length);
+    value.append(position, suffix_length);
+    position += suffix_length;
+    if (functor(value)) {
+      return index_in_block;
+    }
+  }
+  return block_length;
+}
+
+std::string FrontCodedDictionary::operator[](const size_t index) const {
+  const auto block_index = index / BLOCK_SIZE;
+  const auto target_index_in_block = index % BLOCK_SIZE;
+  auto result = std::string{};
+  auto current_index_in_block = size_t{0};
+  _scan_block(block_index, [&](const std::string& value) {
+    if (current_index_in_block++ == target_index_in_block) {
+      result = value;
+      return true;
+    }
+    return false;
+  });
+  return result;
+}
+
+std::string FrontCodedDictionary::at(const size_t index) const {
+  Assert(index < _size, "Index " + std::to_string(index) + " is out of range for dictionary with size " +
+                            std::to_string(_size) + ".");
+  return (*this)[index];
+}
+
+size_t FrontCodedDictionary::size() const {
+  return _size;
+}
+
+std::vector<std::string> FrontCodedDictionary::values() const {
+  auto values = std::vector<std::string>{};
+  values.reserve(_size);
+  for (auto block_index = size_t{0}; block_index < _block_offsets.size(); ++block_index) {
+    _scan_block(block_index, [&](const std::string& value) {
+      values.push_back(value);
+      return false;
+    });
+  }
+  return values;
+}
+
+template <typename Predicate>
+size_t FrontCodedDictionary::_partition_point(const Predicate& predicate) const {
+  // Find the first block whose header fulfills the predicate. Only the block before it can contain the first value
+  // that fulfills the predicate (if it is not the header itself).
+  const auto block_count = _block_offsets.size();
+  auto low = size_t{0};
+  auto high = block_count;
+  while (low < high) {
+    const auto middle = low + (high - low) / 2;
+    if (predicate(_block_headers[middle])) {
+      high = middle;
+    } else {
+      low = middle + 1;
+    }
+  }
+
+  if (low == 0) {
+    return 0;
+  }
+
+  const auto candidate_block = low - 1;
+  const auto index_in_block =
+      _scan_block(candidate_block, [&](const std::string& value) { return predicate(GermanString{value}); });
+  return std::min(candidate_block * BLOCK_SIZE + index_in_block, _size);
+}
+
+size_t FrontCodedDictionary::lower_bound(const std::string_view value) const {
+  const auto search_value = GermanString{value};
+  return _partition_point([&](const GermanString& entry) { return entry >= search_value; });
+}
+
+size_t FrontCodedDictionary::upper_bound(const std::string_view value) const {
+  const auto search_value = GermanString{value};
+  return _partition_point([&](const GermanString& entry) { return entry > search_value; });
+}
+
+size_t FrontCodedDictionary::estimate_memory_usage() const {
+  return _data.size() + _block_offsets.size() * sizeof(uint32_t) + _block_headers.size() * sizeof(GermanString);
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "german_string.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrontCodedDictionary stores a sorted list of unique strings in a single contiguous char buffer. The strings are
+// grouped into blocks of BLOCK_SIZE entries. The first string of each block (the block header) is stored completely,
+// all further strings only store the length of the prefix they share with their predecessor and the remaining suffix.
+// An offset array points to the beginning of each block. Searching performs a binary search over the block headers,
+// followed by a linear scan within a single block. Compared to a std::vector<std::string>, this avoids the 32 byte
+// string header and a separate heap allocation per entry, and it exploits shared prefixes (e.g., of URLs and paths).
+// The block headers are additionally kept as GermanStrings, so that most steps of the binary search are decided by
+// their inlined prefixes without touching the buffer.
+class FrontCodedDictionary : private Noncopyable {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  FrontCodedDictionary() = default;
+
+  // Creates a dictionary from values that are sorted in ascending order and unique.
+  explicit FrontCodedDictionary(const std::vector<GermanString>& sorted_values);
+  explicit FrontCodedDictionary(const std::vector<std::string>& sorted_values);
+
+  FrontCodedDictionary(FrontCodedDictionary&&) = default;
+  FrontCodedDictionary& operator=(FrontCodedDictionary&&) = default;
+
+  // Returns the value at a given position. The value has to be decoded, so it is returned by value.
+  std::string operator[](const size_t index) const;
+
+  // Same as operator[], but throws an error if the index is out of range.
+  std::string at(const size_t index) const;
+
+  // Returns the number of values.
+  size_t size() const;
+
+  // Decodes all values in ascending order. This is faster than calling operator[] for each position, as every block
+  // is scanned only once.
+  std::vector<std::string> values() const;
+
+  // Returns the position of the first value >= the search value, or size() if all values are smaller.
+  size_t lower_bound(const std::string_view value) const;
+
+  // Returns the position of the first value > the search value, or size() if all values are smaller or equal.
+  size_t upper_bound(const std::string_view value) const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // Returns the position of the first value for which the predicate holds. The predicate is called with GermanStrings
+  // and has to be monotonic, i.e., once it holds for a value, it holds for all following values.
+  template <typename Predicate>
+  size_t _partition_point(const Predicate& predicate) const;
+
+  // Decodes the values of a block one after another and passes them to the functor until it returns true. Returns the
+  // position within the block at which the functor returned true, or the number of values in the block.
+  template <typename Functor>
+  size_t _scan_block(const size_t block_index, const Functor& functor) const;
+
+  std::vector<char> _data;
+  std::vector<uint32_t> _block_offsets;
+  // The first value of each block. Long values point into _data.
+  std::vector<GermanString> _block_headers;
+  size_t _size{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,241 @@
+#include "fsst_segment.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace {
+
+// The symbol table is built from a sample of roughly this many bytes. Each generation compresses the sample with the
+// current table and picks the symbols (and concatenations of adjacent symbols) with the highest gain for the next one.
+constexpr auto SAMPLE_SIZE = size_t{16384};
+constexpr auto GENERATION_COUNT = 5;
+
+}  // namespace
+
+namespace opossum {
+
+FSSTSegment::FSSTSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<std::string>>(abstract_segment);
+  Assert(value_segment, "Can't encode abstract segment, because it is no string value segment.");
+
+  const auto& values = value_segment->values();
+  const auto value_segment_size = value_segment->size();
+  if (value_segment->is_nullable()) {
+    _validity = value_segment->null_values();
+  }
+
+  _build_symbol_table(values);
+
+  _offsets.reserve(value_segment_size + 1);
+  _offsets.push_back(0);
+  for (auto index = ChunkOffset{0}; index < value_segment_size; ++index) {
+    if (!is_null(index)) {
+      const auto compressed = compress(values[index]);
+      _compressed_data.insert(_compressed_data.end(), compressed.begin(), compressed.end());
+    }
+    Assert(_compressed_data.size() <= std::numeric_limits<uint32_t>::max(), "FSSTSegment exceeds 4 GB.");
+    _offsets.push_back(static_cast<uint32_t>(_compressed_data.size()));
+  }
+  _compressed_data.shrink_to_fit();
+}
+
+void FSSTSegment::_build_symbol_table(const StringVector& values) {
+  const auto value_count = values.size();
+  auto total_bytes = size_t{0};
+  for (auto index = size_t{0}; index < value_count; ++index) {
+    if (!is_null(index)) {
+      total_bytes += values[index].size();
+    }
+  }
+
+  // Take every n-th value so that the sample covers the whole segment.
+  auto sample = std::vector<std::string_view>{};
+  const auto stride = std::max(size_t{1}, total_bytes / SAMPLE_SIZE);
+  for (auto index = size_t{0}; index < value_count; index += stride) {
+    if (!is_null(index)) {
+      sample.emplace_back(values[index]);
+    }
+  }
+
+  for (auto generation = 0; generation < GENERATION_COUNT; ++generation) {
+    auto frequencies = std::unordered_map<std::string_view, size_t>{};
+    for (const auto& value : sample) {
+      auto position = size_t{0};
+      auto previous_position = size_t{0};
+      auto previous_length = size_t{0};
+      while (position < value.size()) {
+        const auto code = _find_longest_symbol(value.substr(position));
+        const auto length = code == ESCAPE_CODE ? size_t{1} : size_t{_symbol_lengths[code]};
+        ++frequencies[value.substr(position, length)];
+        if (previous_length > 0) {
+          const auto concatenated_length = std::min(previous_length + length, MAX_SYMBOL_LENGTH);
+          ++frequencies[value.substr(previous_position, concatenated_length)];
+        }
+
+        previous_position = position;
+        previous_length = length;
+        position += length;
+      }
+    }
+
+    // Longer symbols save more bytes per occurrence. Ties are broken by the symbol itself to stay deterministic.
+    auto candidates = std::vector<std::pair<size_t, std::string_view>>{};
+    candidates.reserve(frequencies.size());
+    for (const auto& [symbol, frequency] : frequencies) {
+      candidates.emplace_back(frequency * symbol.size(), symbol);
+    }
+    const auto symbol_count = std::min(MAX_SYMBOL_COUNT, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + symbol_count, candidates.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+                      });
+
+    auto symbols = std::vector<std::string_view>{};
+    symbols.reserve(symbol_count);
+    for (auto index = size_t{0}; index < symbol_count; ++index) {
+      symbols.push_back(candidates[index].second);
+    }
+    _set_symbols(symbols);
+  }
+}
+
+void FSSTSegment::_set_symbols(const std::vector<std::string_view>& symbols) {
+  DebugAssert(symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols.");
+  _symbol_count = symbols.size();
+  _first_byte_offsets.fill(0);
+
+  for (auto code = size_t{0}; code < _symbol_count; ++code) {
+    const auto& symbol = symbols[code];
+    _symbols[code] = 0;
+    std::memcpy(&_symbols[code], symbol.data(), symbol.size());
+    _symbol_lengths[code] = static_cast<uint8_t>(symbol.size());
+    _codes_by_first_byte[code] = static_cast<uint8_t>(code);
+    ++_first_byte_offsets[static_cast<uint8_t>(symbol[0]) + 1];
+  }
+  for (auto byte = size_t{1}; byte < _first_byte_offsets.size(); ++byte) {
+    _first_byte_offsets[byte] += _first_byte_offsets[byte - 1];
+  }
+
+  const auto first_byte = [&](const uint8_t code) { return static_cast<uint8_t>(symbols[code][0]); };
+  std::stable_sort(_codes_by_first_byte.begin(), _codes_by_first_byte.begin() + _symbol_count,
+                   [&](const auto lhs, const auto rhs) {
+                     if (first_byte(lhs) != first_byte(rhs)) {
+                       return first_byte(lhs) < first_byte(rhs);
+                     }
+                     return _symbol_lengths[lhs] > _symbol_lengths[rhs];
+                   });
+}
+
+uint8_t FSSTSegment::_find_longest_symbol(const std::string_view value) const {
+  const auto first_byte = static_cast<uint8_t>(value[0]);
+  for (auto index = _first_byte_offsets[first_byte]; index < _first_byte_offsets[first_byte + 1]; ++index) {
+    const auto code = _codes_by_first_byte[index];
+    const auto length = _symbol_lengths[code];
+    if (length <= value.size() && std::memcmp(&_symbols[code], value.data(), length) == 0) {
+      return code;
+    }
+  }
+  return ESCAPE_CODE;
+}
+
+std::string FSSTSegment::compress(const std::string_view value) const {
+  auto compressed = std::string{};
+  compressed.reserve(value.size());
+  auto position = size_t{0};
+  while (position < value.size()) {
+    const auto code = _find_longest_symbol(value.substr(position));
+    compressed.push_back(static_cast<char>(code));
+    if (code == ESCAPE_CODE) {
+      compressed.push_back(value[position]);
+      ++position;
+    } else {
+      position += _symbol_lengths[code];
+    }
+  }
+  return compressed;
+}
+
+std::string_view FSSTSegment::compressed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Chunk offset " + std::to_string(chunk_offset) + " is out of range.");
+  return std::string_view{_compressed_data.data() + _offsets[chunk_offset],
+                          _offsets[chunk_offset + 1] - _offsets[chunk_offset]};
+}
+
+AllTypeVariant FSSTSegment::operator[](const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  if (return_value) {
+    return *return_value;
+  }
+  return NULL_VALUE;
+}
+
+bool FSSTSegment::is_null(const ChunkOffset chunk_offset) const {
+  return !_validity.empty() && _validity.is_null(chunk_offset);
+}
+
+std::string FSSTSegment::get(const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  Assert(return_value.has_value(), "Value at position: " + std::to_string(chunk_offset) + " is NULL!");
+  return *return_value;
+}
+
+std::optional<std::string> FSSTSegment::get_typed_value(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Chunk offset " + std::to_string(chunk_offset) + " is out of range.");
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  const auto compressed = compressed_value(chunk_offset);
+  // Every symbol is copied as a full word, so the buffer needs MAX_SYMBOL_LENGTH bytes of slack.
+  auto value = std::string(compressed.size() * MAX_SYMBOL_LENGTH + MAX_SYMBOL_LENGTH, '\0');
+  auto length = size_t{0};
+  for (auto position = size_t{0}; position < compressed.size(); ++position) {
+    const auto code = static_cast<uint8_t>(compressed[position]);
+    if (code == ESCAPE_CODE) {
+      value[length++] = compressed[++position];
+    } else {
+      std::memcpy(value.data() + length, &_symbols[code], MAX_SYMBOL_LENGTH);
+      length += _symbol_lengths[code];
+    }
+  }
+  value.resize(length);
+  return value;
+}
+
+size_t FSSTSegment::symbol_count() const {
+  return _symbol_count;
+}
+
+void FSSTSegment::materialize_range(const ChunkOffset begin, const ChunkOffset end, std::string* out,
+                                    ValidityBitmap* nulls) const {
+  Assert(begin <= end && end <= size(), "Invalid range for FSSTSegment::materialize_range.");
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    auto value = get_typed_value(chunk_offset);
+    out[chunk_offset - begin] = value ? std::move(*value) : std::string{};
+  }
+
+  if (nulls) {
+    if (_validity.empty()) {
+      nulls->assign(end - begin, true);
+    } else {
+      nulls->assign(_validity, begin, end);
+    }
+  }
+}
+
+ChunkOffset FSSTSegment::size() const {
+  return static_cast<ChunkOffset>(_offsets.size() - 1);
+}
+
+size_t FSSTSegment::estimate_memory_usage() const {
+  return _compressed_data.size() + _offsets.size() * sizeof(uint32_t) +
+         _symbol_count * (sizeof(uint64_t) + sizeof(uint8_t)) + sizeof(_codes_by_first_byte) +
+         sizeof(_first_byte_offsets) + _validity.estimate_memory_usage();
+}
+
+}  // namespace opossum
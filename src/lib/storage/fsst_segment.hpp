@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "abstract_segment.hpp"
+#include "string_vector.hpp"
+#include "validity_bitmap.hpp"
+
+namespace opossum {
+
+// FSSTSegment is a segment type for string columns with many distinct values (e.g., user agents or log messages), for
+// which a dictionary would be as large as the data itself. Following the idea of Fast Static Symbol Tables (FSST), it
+// builds a table of up to 255 frequent substrings (symbols) of up to eight bytes from a sample of the segment. Each
+// value is compressed individually by replacing substrings with their one-byte code. Bytes not covered by a symbol are
+// stored as an escape code followed by the literal byte. Because values are compressed independently, single values can
+// be decoded without touching their neighbors. Compression is deterministic, so equal strings have equal compressed
+// representations and equality predicates can compare compressed bytes (see compress() and compressed_value()).
+class FSSTSegment : public AbstractSegment {
+ public:
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // Creates an FSSTSegment from a given string value segment.
+  explicit FSSTSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  std::string get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<std::string> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Decompresses the values of the rows [begin, end) into out, which has to hold end - begin entries. NULL rows are
+  // left empty. If nulls is given, it is refilled with the validity of the rows.
+  void materialize_range(const ChunkOffset begin, const ChunkOffset end, std::string* out,
+                         ValidityBitmap* nulls) const;
+
+  // Compresses a value with the symbol table of this segment. Equality predicates compress their search value once and
+  // compare it with compressed_value() for each row.
+  std::string compress(const std::string_view value) const;
+
+  // Returns the compressed bytes of the value at a certain position. The result is empty for NULL values.
+  std::string_view compressed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the number of symbols in the symbol table.
+  size_t symbol_count() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Builds the symbol table from a sample of the given (non-NULL) values.
+  void _build_symbol_table(const StringVector& values);
+
+  // Replaces the symbol table with the given symbols.
+  void _set_symbols(const std::vector<std::string_view>& symbols);
+
+  // Returns the code of the longest symbol that is a prefix of the given value, or ESCAPE_CODE if there is none.
+  uint8_t _find_longest_symbol(const std::string_view value) const;
+
+  // Symbols are stored as little-endian words so that decoding can copy all eight bytes at once.
+  std::array<uint64_t, MAX_SYMBOL_COUNT> _symbols{};
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _symbol_lengths{};
+  size_t _symbol_count{0};
+
+  // The codes of all symbols, grouped by their first byte and ordered by descending length within each group. The
+  // codes of the symbols starting with byte b are [_codes_by_first_byte[_first_byte_offsets[b]],
+  // _codes_by_first_byte[_first_byte_offsets[b + 1]]).
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _codes_by_first_byte{};
+  std::array<uint8_t, 257> _first_byte_offsets{};
+
+  std::vector<char> _compressed_data;
+  std::vector<uint32_t> _offsets;
+  // Empty if the segment is not nullable.
+  ValidityBitmap _validity;
+};
+
+}  // namespace opossum
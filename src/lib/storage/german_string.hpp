@@ -0,0 +1,104 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// GermanString is a 16 byte representation of a string value. The first four bytes hold the length, the next four the
+// first characters of the value (the prefix, padded with zero bytes). Values of up to INLINE_CAPACITY characters are
+// stored completely within the remaining eight bytes, longer ones store a pointer to the full value there. Thus, most
+// comparisons are decided by the length and the prefix without dereferencing the pointer, and short values do not need
+// any memory besides the 16 bytes.
+//
+// GermanString does not own the memory of long values: they point to the bytes the GermanString was created from,
+// which have to outlive it (e.g., an arena such as the one of StringVector).
+class alignas(8) GermanString {
+ public:
+  static constexpr auto PREFIX_LENGTH = size_t{4};
+  static constexpr auto INLINE_CAPACITY = size_t{12};
+
+  GermanString() = default;
+
+  explicit GermanString(const std::string_view value) : _length{static_cast<uint32_t>(value.size())} {
+    DebugAssert(value.size() <= std::numeric_limits<uint32_t>::max(), "GermanString is limited to 4 GB.");
+    if (value.size() <= INLINE_CAPACITY) {
+      std::memcpy(_data, value.data(), value.size());
+      return;
+    }
+
+    std::memcpy(_data, value.data(), PREFIX_LENGTH);
+    const auto* pointer = value.data();
+    std::memcpy(_data + PREFIX_LENGTH, &pointer, sizeof(pointer));
+  }
+
+  // Returns the number of characters.
+  size_t size() const {
+    return _length;
+  }
+
+  // Returns whether the value is stored within the GermanString itself.
+  bool is_inlined() const {
+    return _length <= INLINE_CAPACITY;
+  }
+
+  // Returns the first PREFIX_LENGTH characters. Shorter values are padded with zero bytes.
+  std::string_view prefix() const {
+    return std::string_view{_data, PREFIX_LENGTH};
+  }
+
+  // Returns the complete value. It points either into the GermanString or to the memory it was created from.
+  std::string_view view() const {
+    if (is_inlined()) {
+      return std::string_view{_data, _length};
+    }
+    const char* pointer;
+    std::memcpy(&pointer, _data + PREFIX_LENGTH, sizeof(pointer));
+    return std::string_view{pointer, _length};
+  }
+
+  explicit operator std::string() const {
+    return std::string{view()};
+  }
+
+  // Values of different length or prefix are unequal. Inlined values are compared completely with the second word,
+  // as their unused bytes are zero. Only equal long values have to be compared via their pointers.
+  friend bool operator==(const GermanString& lhs, const GermanString& rhs) {
+    uint64_t lhs_head;
+    uint64_t rhs_head;
+    std::memcpy(&lhs_head, &lhs, sizeof(lhs_head));
+    std::memcpy(&rhs_head, &rhs, sizeof(rhs_head));
+    if (lhs_head != rhs_head) {
+      return false;
+    }
+    if (lhs.is_inlined()) {
+      return std::memcmp(lhs._data + PREFIX_LENGTH, rhs._data + PREFIX_LENGTH, sizeof(uint64_t)) == 0;
+    }
+    return lhs.view() == rhs.view();
+  }
+
+  // A difference within the prefixes decides the order, as the zero padding orders shorter values first. Otherwise,
+  // the values are compared completely.
+  friend std::strong_ordering operator<=>(const GermanString& lhs, const GermanString& rhs) {
+    const auto prefix_comparison = std::memcmp(lhs._data, rhs._data, PREFIX_LENGTH);
+    if (prefix_comparison != 0) {
+      return prefix_comparison <=> 0;
+    }
+    return lhs.view().compare(rhs.view()) <=> 0;
+  }
+
+ protected:
+  uint32_t _length{0};
+  // The prefix followed by either the remaining characters or the pointer to the value.
+  char _data[INLINE_CAPACITY]{};
+};
+
+static_assert(sizeof(GermanString) == 16, "GermanString is expected to occupy 16 bytes.");
+
+}  // namespace opossum
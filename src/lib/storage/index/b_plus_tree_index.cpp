@@ -0,0 +1,245 @@
+#include "b_plus_tree_index.hpp"
+
+#include <algorithm>
+
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+BPlusTreeIndex<T>::BPlusTreeIndex(const AbstractSegment& segment) {
+  auto rows = std::vector<std::pair<T, ChunkOffset>>{};
+  rows.reserve(segment.size());
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (!position.is_null) {
+      rows.emplace_back(T{position.value}, position.chunk_offset);
+    }
+  });
+  std::stable_sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  _size = rows.size();
+
+  // Bulk loading: the sorted rows are cut into full leaves, then each level of inner nodes is built on top of the
+  // previous one, until a single root remains. Each node is stored with the smallest value of its subtree, which
+  // becomes the separator in front of it.
+  auto level = std::vector<std::pair<std::unique_ptr<Node>, T>>{};
+  for (auto begin = size_t{0}; begin < rows.size(); begin += NODE_CAPACITY) {
+    const auto end = std::min(begin + NODE_CAPACITY, rows.size());
+    auto leaf = std::make_unique<Node>(true);
+    leaf->keys.reserve(NODE_CAPACITY + 1);
+    leaf->chunk_offsets.reserve(NODE_CAPACITY + 1);
+    for (auto index = begin; index < end; ++index) {
+      leaf->keys.push_back(std::move(rows[index].first));
+      leaf->chunk_offsets.push_back(rows[index].second);
+    }
+    if (!level.empty()) {
+      level.back().first->next_leaf = leaf.get();
+    }
+    auto min = leaf->keys.front();
+    level.emplace_back(std::move(leaf), std::move(min));
+  }
+
+  while (level.size() > 1) {
+    auto parent_level = std::vector<std::pair<std::unique_ptr<Node>, T>>{};
+    for (auto begin = size_t{0}; begin < level.size(); begin += NODE_CAPACITY) {
+      const auto end = std::min(begin + NODE_CAPACITY, level.size());
+      auto node = std::make_unique<Node>(false);
+      for (auto index = begin; index < end; ++index) {
+        if (index > begin) {
+          node->keys.push_back(level[index].second);
+        }
+        node->children.push_back(std::move(level[index].first));
+      }
+      parent_level.emplace_back(std::move(node), std::move(level[begin].second));
+    }
+    level = std::move(parent_level);
+  }
+
+  _root = level.empty() ? std::make_unique<Node>(true) : std::move(level.front().first);
+}
+
+template <typename T>
+void BPlusTreeIndex<T>::insert(const AllTypeVariant& value, const ChunkOffset chunk_offset) {
+  if (!variant_is_null(value)) {
+    insert_typed(type_cast<T>(value), chunk_offset);
+  }
+}
+
+template <typename T>
+void BPlusTreeIndex<T>::insert_typed(const T& value, const ChunkOffset chunk_offset) {
+  auto split = _insert(*_root, value, chunk_offset);
+  if (split) {
+    // The root was split, so the tree grows by one level.
+    auto root = std::make_unique<Node>(false);
+    root->keys.push_back(std::move(split->first));
+    root->children.push_back(std::move(_root));
+    root->children.push_back(std::move(split->second));
+    _root = std::move(root);
+  }
+  ++_size;
+}
+
+template <typename T>
+std::optional<std::pair<T, std::unique_ptr<typename BPlusTreeIndex<T>::Node>>> BPlusTreeIndex<T>::_insert(
+    Node& node, const T& value, const ChunkOffset chunk_offset) {
+  // Rows are inserted behind all rows with an equal value. As rows are usually appended with increasing chunk
+  // offsets, this keeps the rows of a value in order.
+  const auto index = static_cast<size_t>(
+      std::distance(node.keys.begin(), std::upper_bound(node.keys.begin(), node.keys.end(), value)));
+
+  if (node.is_leaf) {
+    node.keys.insert(node.keys.begin() + index, value);
+    node.chunk_offsets.insert(node.chunk_offsets.begin() + index, chunk_offset);
+    if (node.keys.size() <= NODE_CAPACITY) {
+      return std::nullopt;
+    }
+
+    const auto middle = node.keys.size() / 2;
+    auto sibling = std::make_unique<Node>(true);
+    sibling->keys.assign(std::make_move_iterator(node.keys.begin() + middle), std::make_move_iterator(node.keys.end()));
+    sibling->chunk_offsets.assign(node.chunk_offsets.begin() + middle, node.chunk_offsets.end());
+    node.keys.resize(middle);
+    node.chunk_offsets.resize(middle);
+    sibling->next_leaf = node.next_leaf;
+    node.next_leaf = sibling.get();
+    auto separator = sibling->keys.front();
+    return std::pair{std::move(separator), std::move(sibling)};
+  }
+
+  auto child_split = _insert(*node.children[index], value, chunk_offset);
+  if (!child_split) {
+    return std::nullopt;
+  }
+  node.keys.insert(node.keys.begin() + index, std::move(child_split->first));
+  node.children.insert(node.children.begin() + index + 1, std::move(child_split->second));
+  if (node.children.size() <= NODE_CAPACITY) {
+    return std::nullopt;
+  }
+
+  // The separator between both halves moves up to the parent.
+  const auto middle = node.children.size() / 2;
+  auto sibling = std::make_unique<Node>(false);
+  sibling->keys.assign(std::make_move_iterator(node.keys.begin() + middle), std::make_move_iterator(node.keys.end()));
+  sibling->children.assign(std::make_move_iterator(node.children.begin() + middle),
+                           std::make_move_iterator(node.children.end()));
+  auto separator = std::move(node.keys[middle - 1]);
+  node.keys.resize(middle - 1);
+  node.children.resize(middle);
+  return std::pair{std::move(separator), std::move(sibling)};
+}
+
+template <typename T>
+void BPlusTreeIndex<T>::append_matches(const ScanType scan_type, const AllTypeVariant& search_value,
+                                       const ChunkID chunk_id, PosList& matches) const {
+  if (variant_is_null(search_value)) {
+    return;
+  }
+  const auto typed_search_value = type_cast<T>(search_value);
+  const auto end = Position{nullptr, 0};
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      _append_rows(_lower_bound(typed_search_value), _upper_bound(typed_search_value), chunk_id, matches);
+      return;
+    case ScanType::OpNotEquals:
+      _append_rows(_begin(), _lower_bound(typed_search_value), chunk_id, matches);
+      _append_rows(_upper_bound(typed_search_value), end, chunk_id, matches);
+      return;
+    case ScanType::OpLessThan:
+      _append_rows(_begin(), _lower_bound(typed_search_value), chunk_id, matches);
+      return;
+    case ScanType::OpLessThanEquals:
+      _append_rows(_begin(), _upper_bound(typed_search_value), chunk_id, matches);
+      return;
+    case ScanType::OpGreaterThan:
+      _append_rows(_upper_bound(typed_search_value), end, chunk_id, matches);
+      return;
+    case ScanType::OpGreaterThanEquals:
+      _append_rows(_lower_bound(typed_search_value), end, chunk_id, matches);
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+template <typename T>
+void BPlusTreeIndex<T>::append_range_matches(const T& min, const T& max, const ChunkID chunk_id,
+                                             PosList& matches) const {
+  if (!(max < min)) {
+    _append_rows(_lower_bound(min), _upper_bound(max), chunk_id, matches);
+  }
+}
+
+template <typename T>
+size_t BPlusTreeIndex<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t BPlusTreeIndex<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _estimate_memory_usage(*_root);
+}
+
+template <typename T>
+typename BPlusTreeIndex<T>::Position BPlusTreeIndex<T>::_lower_bound(const T& value) const {
+  // All values in the children left of the first separator >= value are smaller than the value.
+  const auto* node = _root.get();
+  while (!node->is_leaf) {
+    const auto child = std::lower_bound(node->keys.begin(), node->keys.end(), value) - node->keys.begin();
+    node = node->children[child].get();
+  }
+  const auto index = std::lower_bound(node->keys.begin(), node->keys.end(), value) - node->keys.begin();
+  return _skip_leaf_ends({node, static_cast<size_t>(index)});
+}
+
+template <typename T>
+typename BPlusTreeIndex<T>::Position BPlusTreeIndex<T>::_upper_bound(const T& value) const {
+  const auto* node = _root.get();
+  while (!node->is_leaf) {
+    const auto child = std::upper_bound(node->keys.begin(), node->keys.end(), value) - node->keys.begin();
+    node = node->children[child].get();
+  }
+  const auto index = std::upper_bound(node->keys.begin(), node->keys.end(), value) - node->keys.begin();
+  return _skip_leaf_ends({node, static_cast<size_t>(index)});
+}
+
+template <typename T>
+typename BPlusTreeIndex<T>::Position BPlusTreeIndex<T>::_begin() const {
+  const auto* node = _root.get();
+  while (!node->is_leaf) {
+    node = node->children.front().get();
+  }
+  return _skip_leaf_ends({node, 0});
+}
+
+template <typename T>
+typename BPlusTreeIndex<T>::Position BPlusTreeIndex<T>::_skip_leaf_ends(Position position) {
+  while (position.leaf && position.index == position.leaf->keys.size()) {
+    position = {position.leaf->next_leaf, 0};
+  }
+  return position;
+}
+
+template <typename T>
+void BPlusTreeIndex<T>::_append_rows(Position begin, const Position end, const ChunkID chunk_id, PosList& matches) {
+  while (begin != end) {
+    matches.emplace_back(RowID{chunk_id, begin.leaf->chunk_offsets[begin.index]});
+    ++begin.index;
+    begin = _skip_leaf_ends(begin);
+  }
+}
+
+template <typename T>
+size_t BPlusTreeIndex<T>::_estimate_memory_usage(const Node& node) {
+  auto memory_usage = sizeof(node) + node.keys.capacity() * sizeof(T) +
+                      node.chunk_offsets.capacity() * sizeof(ChunkOffset) +
+                      node.children.capacity() * sizeof(std::unique_ptr<Node>);
+  for (const auto& child : node.children) {
+    memory_usage += _estimate_memory_usage(*child);
+  }
+  return memory_usage;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BPlusTreeIndex);
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_index.hpp"
+#include "storage/abstract_segment.hpp"
+
+namespace opossum {
+
+// A BPlusTreeIndex is an ordered index that, unlike GroupKeyIndex, can be maintained while rows are appended. It is
+// therefore meant for the ValueSegments of the open chunk, whose rows would otherwise only be found by a full scan,
+// but it can be built for segments of any encoding. The leaves store the values with their chunk offsets in sorted
+// order and are linked, so that a range lookup descends the tree once and then reads the leaves from left to right.
+// Rows with equal values are kept in the order of their chunk offsets. NULL rows are not indexed.
+template <typename T>
+class BPlusTreeIndex : public BaseIndex {
+ public:
+  // The maximum number of rows of a leaf and of children of an inner node.
+  static constexpr auto NODE_CAPACITY = size_t{64};
+
+  // Creates an index for the current rows of the segment. The leaves are filled completely.
+  explicit BPlusTreeIndex(const AbstractSegment& segment);
+
+  void insert(const AllTypeVariant& value, const ChunkOffset chunk_offset) final;
+
+  // Same as insert(AllTypeVariant, ChunkOffset) for a value other than NULL.
+  void insert_typed(const T& value, const ChunkOffset chunk_offset);
+
+  void append_matches(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+                      PosList& matches) const final;
+
+  // Appends the rows whose values are in [min, max] to matches, with the given chunk id.
+  void append_range_matches(const T& min, const T& max, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns the number of indexed rows.
+  size_t size() const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  struct Node {
+    explicit Node(const bool init_is_leaf) : is_leaf(init_is_leaf) {}
+
+    bool is_leaf;
+    // The values of the rows in leaves. In inner nodes, keys[i] separates children[i] and children[i + 1]: no value in
+    // children[i] is larger, and no value in children[i + 1] is smaller.
+    std::vector<T> keys;
+    std::vector<ChunkOffset> chunk_offsets;
+    std::vector<std::unique_ptr<Node>> children;
+    Node* next_leaf{nullptr};
+  };
+
+  // A row in a leaf. The position after the last row has no leaf.
+  struct Position {
+    const Node* leaf;
+    size_t index;
+
+    bool operator==(const Position& other) const = default;
+  };
+
+  // Inserts the row into the subtree. If the node had to be split, returns the separator and the new right sibling.
+  std::optional<std::pair<T, std::unique_ptr<Node>>> _insert(Node& node, const T& value,
+                                                            const ChunkOffset chunk_offset);
+
+  // Return the position of the first row whose value is >= (lower_bound) or > (upper_bound) the search value.
+  Position _lower_bound(const T& value) const;
+  Position _upper_bound(const T& value) const;
+
+  Position _begin() const;
+
+  // Moves a position behind the last row of a leaf to the first row of the next non-empty leaf.
+  static Position _skip_leaf_ends(Position position);
+
+  static void _append_rows(Position begin, const Position end, const ChunkID chunk_id, PosList& matches);
+
+  static size_t _estimate_memory_usage(const Node& node);
+
+  std::unique_ptr<Node> _root;
+  size_t _size{0};
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(BPlusTreeIndex);
+
+}  // namespace opossum
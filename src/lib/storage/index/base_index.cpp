@@ -0,0 +1,11 @@
+#include "base_index.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void BaseIndex::insert(const AllTypeVariant& /*value*/, const ChunkOffset /*chunk_offset*/) {
+  Fail("Index cannot be maintained on append.");
+}
+
+}  // namespace opossum
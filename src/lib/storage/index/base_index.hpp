@@ -0,0 +1,32 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The kinds of secondary indexes that a table can maintain for the segments of a column (see
+// Table::set_column_index_type).
+enum class IndexType { GroupKey, BPlusTree, Cracking, Imprint };
+
+// BaseIndex is the abstract super class for all secondary indexes. An index belongs to a single segment and finds the
+// rows of the segment that satisfy a predicate without reading all of its values.
+class BaseIndex : private Noncopyable {
+ public:
+  BaseIndex() = default;
+  virtual ~BaseIndex() = default;
+
+  // Appends the rows that satisfy `value <scan_type> search_value` to matches, with the given chunk id. The rows are
+  // not necessarily in the order of their chunk offsets. NULL rows never match, and neither does a NULL search value.
+  virtual void append_matches(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+                              PosList& matches) const = 0;
+
+  // Adds a row that was appended to the segment. NULL values are not indexed. Indexes that cannot be maintained, i.e.,
+  // those of immutable segments, fail.
+  virtual void insert(const AllTypeVariant& value, const ChunkOffset chunk_offset);
+
+  // Returns the calculated memory usage.
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+}  // namespace opossum
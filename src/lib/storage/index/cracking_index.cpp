@@ -0,0 +1,142 @@
+#include "cracking_index.hpp"
+
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+bool CrackingIndex<T>::Bound::operator<(const Bound& other) const {
+  if (value < other.value || other.value < value) {
+    return value < other.value;
+  }
+  return !inclusive && other.inclusive;
+}
+
+template <typename T>
+CrackingIndex<T>::CrackingIndex(const std::shared_ptr<const AbstractSegment>& segment) : _segment(segment) {}
+
+template <typename T>
+void CrackingIndex<T>::append_matches(const ScanType scan_type, const AllTypeVariant& search_value,
+                                      const ChunkID chunk_id, PosList& matches) const {
+  if (variant_is_null(search_value)) {
+    return;
+  }
+  const auto typed_search_value = type_cast<T>(search_value);
+  const auto lock = std::lock_guard{_mutex};
+  _materialize();
+
+  const auto size = _values.size();
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      _append_rows(_crack({typed_search_value, false}), _crack({typed_search_value, true}), chunk_id, matches);
+      return;
+    case ScanType::OpNotEquals:
+      _append_rows(0, _crack({typed_search_value, false}), chunk_id, matches);
+      _append_rows(_crack({typed_search_value, true}), size, chunk_id, matches);
+      return;
+    case ScanType::OpLessThan:
+      _append_rows(0, _crack({typed_search_value, false}), chunk_id, matches);
+      return;
+    case ScanType::OpLessThanEquals:
+      _append_rows(0, _crack({typed_search_value, true}), chunk_id, matches);
+      return;
+    case ScanType::OpGreaterThan:
+      _append_rows(_crack({typed_search_value, true}), size, chunk_id, matches);
+      return;
+    case ScanType::OpGreaterThanEquals:
+      _append_rows(_crack({typed_search_value, false}), size, chunk_id, matches);
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+template <typename T>
+void CrackingIndex<T>::append_range_matches(const T& min, const T& max, const ChunkID chunk_id,
+                                            PosList& matches) const {
+  if (max < min) {
+    return;
+  }
+  const auto lock = std::lock_guard{_mutex};
+  _materialize();
+  _append_rows(_crack({min, false}), _crack({max, true}), chunk_id, matches);
+}
+
+template <typename T>
+size_t CrackingIndex<T>::crack_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _cracks.size();
+}
+
+template <typename T>
+size_t CrackingIndex<T>::estimate_memory_usage() const {
+  const auto lock = std::lock_guard{_mutex};
+  // Each crack is a node of a red-black tree, which adds three pointers and a color to the entry.
+  const auto crack_size = sizeof(typename decltype(_cracks)::value_type) + 4 * sizeof(void*);
+  return sizeof(*this) + _values.capacity() * sizeof(T) + _chunk_offsets.capacity() * sizeof(ChunkOffset) +
+         _cracks.size() * crack_size;
+}
+
+template <typename T>
+size_t CrackingIndex<T>::_crack(const Bound& bound) const {
+  const auto next_crack = _cracks.lower_bound(bound);
+  if (next_crack != _cracks.end() && !(bound < next_crack->first)) {
+    return next_crack->second;
+  }
+
+  // The bound falls into the piece between the previous and the next crack. Its values are partitioned in place
+  // (crack-in-two): values below the bound are swapped from the end of the piece with values from its beginning.
+  const auto below_bound = [&](const T& value) {
+    return bound.inclusive ? !(bound.value < value) : value < bound.value;
+  };
+  auto left = next_crack == _cracks.begin() ? size_t{0} : std::prev(next_crack)->second;
+  auto right = next_crack == _cracks.end() ? _values.size() : next_crack->second;
+  while (true) {
+    while (left < right && below_bound(_values[left])) {
+      ++left;
+    }
+    while (left < right && !below_bound(_values[right - 1])) {
+      --right;
+    }
+    if (left == right) {
+      break;
+    }
+    --right;
+    std::swap(_values[left], _values[right]);
+    std::swap(_chunk_offsets[left], _chunk_offsets[right]);
+    ++left;
+  }
+
+  _cracks.emplace_hint(next_crack, bound, left);
+  return left;
+}
+
+template <typename T>
+void CrackingIndex<T>::_materialize() const {
+  if (!_segment) {
+    return;
+  }
+  _values.reserve(_segment->size());
+  _chunk_offsets.reserve(_segment->size());
+  segment_iterate<T>(*_segment, [&](const auto& position) {
+    if (!position.is_null) {
+      _values.emplace_back(position.value);
+      _chunk_offsets.push_back(position.chunk_offset);
+    }
+  });
+  _segment = nullptr;
+}
+
+template <typename T>
+void CrackingIndex<T>::_append_rows(const size_t begin, const size_t end, const ChunkID chunk_id,
+                                    PosList& matches) const {
+  matches.reserve(matches.size() + (end - begin));
+  for (auto position = begin; position < end; ++position) {
+    matches.emplace_back(RowID{chunk_id, _chunk_offsets[position]});
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(CrackingIndex);
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "base_index.hpp"
+#include "storage/abstract_segment.hpp"
+
+namespace opossum {
+
+// A CrackingIndex adapts to the predicates that are evaluated on a segment instead of being built up front (database
+// cracking). At the first query, the non-NULL values of the segment are copied into a cracker column, together with
+// their chunk offsets. Each query then partitions the pieces of the cracker column that contain its bounds, so that
+// the matches end up in a contiguous range, and remembers the positions of the bounds. Later queries only partition
+// the pieces that their bounds fall into, which become smaller with each query, so that repeated range queries
+// converge to the speed of a sorted index. The cracker column is reorganized by queries, which are serialized by a
+// mutex. Rows cannot be inserted, so the index is meant for immutable segments.
+template <typename T>
+class CrackingIndex : public BaseIndex {
+ public:
+  explicit CrackingIndex(const std::shared_ptr<const AbstractSegment>& segment);
+
+  void append_matches(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+                      PosList& matches) const final;
+
+  // Appends the rows whose values are in [min, max] to matches, with the given chunk id.
+  void append_range_matches(const T& min, const T& max, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns the number of positions at which the cracker column has been partitioned so far.
+  size_t crack_count() const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // A crack separates the values that are below the bound from the others. Values equal to the bound are below it if
+  // it is inclusive. Bounds with the same value are ordered exclusive first, as their cracks are at smaller positions.
+  struct Bound {
+    T value;
+    bool inclusive;
+
+    bool operator<(const Bound& other) const;
+  };
+
+  // Returns the position of the crack for the bound, partitioning the piece that contains it if there is none yet.
+  size_t _crack(const Bound& bound) const;
+
+  // Copies the values of the segment into the cracker column when the index is used for the first time.
+  void _materialize() const;
+
+  void _append_rows(const size_t begin, const size_t end, const ChunkID chunk_id, PosList& matches) const;
+
+  mutable std::mutex _mutex;
+  // The segment is released once the cracker column has been created.
+  mutable std::shared_ptr<const AbstractSegment> _segment;
+  mutable std::vector<T> _values;
+  mutable std::vector<ChunkOffset> _chunk_offsets;
+  mutable std::map<Bound, size_t> _cracks;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(CrackingIndex);
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#include "group_key_index.hpp"
+
+#include "storage/abstract_attribute_vector.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+template <typename T>
+GroupKeyIndex<T>::GroupKeyIndex(const std::shared_ptr<const DictionarySegment<T>>& segment)
+    : _segment(segment), _value_offsets(segment->unique_values_count() + 1) {
+  const auto& attribute_vector = *segment->attribute_vector();
+  const auto size = attribute_vector.size();
+  auto value_ids = std::vector<ValueID::base_type>(size);
+  attribute_vector.decode(0, size, value_ids.data());
+
+  // In nullable segments, value id 0 represents NULL and value id i + 1 the value at position i of the dictionary.
+  const auto null_value_id = static_cast<ValueID::base_type>(segment->null_value_id());
+  const auto first_value_id = ValueID::base_type{null_value_id == INVALID_VALUE_ID ? 0u : 1u};
+
+  // A counting sort: first count the rows of each value, then write each row to the next free slot of its value.
+  for (const auto value_id : value_ids) {
+    if (value_id != null_value_id) {
+      ++_value_offsets[value_id - first_value_id + 1];
+    }
+  }
+  for (auto position = size_t{1}; position < _value_offsets.size(); ++position) {
+    _value_offsets[position] += _value_offsets[position - 1];
+  }
+
+  _postings.resize(_value_offsets.back());
+  auto next_slots = std::vector<ChunkOffset>(_value_offsets.begin(), _value_offsets.end() - 1);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    const auto value_id = value_ids[chunk_offset];
+    if (value_id != null_value_id) {
+      _postings[next_slots[value_id - first_value_id]++] = chunk_offset;
+    }
+  }
+}
+
+template <typename T>
+typename GroupKeyIndex<T>::Iterator GroupKeyIndex<T>::lower_bound(const T& value) const {
+  return _rows_of_position(_segment->lower_bound(value));
+}
+
+template <typename T>
+typename GroupKeyIndex<T>::Iterator GroupKeyIndex<T>::upper_bound(const T& value) const {
+  return _rows_of_position(_segment->upper_bound(value));
+}
+
+template <typename T>
+typename GroupKeyIndex<T>::Iterator GroupKeyIndex<T>::cbegin() const {
+  return _postings.cbegin();
+}
+
+template <typename T>
+typename GroupKeyIndex<T>::Iterator GroupKeyIndex<T>::cend() const {
+  return _postings.cend();
+}
+
+template <typename T>
+void GroupKeyIndex<T>::append_matches(const ScanType scan_type, const AllTypeVariant& search_value,
+                                      const ChunkID chunk_id, PosList& matches) const {
+  if (variant_is_null(search_value)) {
+    return;
+  }
+  const auto typed_search_value = type_cast<T>(search_value);
+  const auto append_rows = [&](const Iterator begin, const Iterator end) {
+    matches.reserve(matches.size() + std::distance(begin, end));
+    for (auto row = begin; row != end; ++row) {
+      matches.emplace_back(RowID{chunk_id, *row});
+    }
+  };
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      append_rows(lower_bound(typed_search_value), upper_bound(typed_search_value));
+      return;
+    case ScanType::OpNotEquals:
+      append_rows(cbegin(), lower_bound(typed_search_value));
+      append_rows(upper_bound(typed_search_value), cend());
+      return;
+    case ScanType::OpLessThan:
+      append_rows(cbegin(), lower_bound(typed_search_value));
+      return;
+    case ScanType::OpLessThanEquals:
+      append_rows(cbegin(), upper_bound(typed_search_value));
+      return;
+    case ScanType::OpGreaterThan:
+      append_rows(upper_bound(typed_search_value), cend());
+      return;
+    case ScanType::OpGreaterThanEquals:
+      append_rows(lower_bound(typed_search_value), cend());
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+template <typename T>
+size_t GroupKeyIndex<T>::estimate_memory_usage() const {
+  return sizeof(*this) + (_value_offsets.capacity() + _postings.capacity()) * sizeof(ChunkOffset);
+}
+
+template <typename T>
+typename GroupKeyIndex<T>::Iterator GroupKeyIndex<T>::_rows_of_position(const ValueID position) const {
+  if (position == INVALID_VALUE_ID) {
+    return cend();
+  }
+  return _postings.cbegin() + _value_offsets[position];
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(GroupKeyIndex);
+
+}  // namespace opossum
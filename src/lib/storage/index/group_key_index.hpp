@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+// A GroupKeyIndex is an inverted index on a DictionarySegment. It stores the chunk offsets of the rows grouped by
+// their value id, i.e., all rows of the first dictionary value, then all rows of the second one, and so on. As the
+// dictionary is sorted, the rows of any range of values are a contiguous slice of these postings, which is found with
+// a lower_bound or upper_bound on the dictionary and a lookup of the offset of the value id. Selective predicates thus
+// only read their result, instead of the whole attribute vector. NULL rows are not indexed.
+template <typename T>
+class GroupKeyIndex : public BaseIndex {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit GroupKeyIndex(const std::shared_ptr<const DictionarySegment<T>>& segment);
+
+  // Returns an iterator to the first row whose value is >= the search value, or cend() if there is none.
+  Iterator lower_bound(const T& value) const;
+
+  // Returns an iterator to the first row whose value is > the search value, or cend() if there is none.
+  Iterator upper_bound(const T& value) const;
+
+  // Return iterators over the rows of all values other than NULL, grouped by value in ascending order.
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  void append_matches(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+                      PosList& matches) const final;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Returns an iterator to the first row of the value at a position in the dictionary. For INVALID_VALUE_ID, which
+  // the search functions of DictionarySegment return if no value is large enough, it returns cend().
+  Iterator _rows_of_position(const ValueID position) const;
+
+  const std::shared_ptr<const DictionarySegment<T>> _segment;
+  // The rows of the value at position i of the dictionary are [_postings[_value_offsets[i]],
+  // _postings[_value_offsets[i + 1]]). There is an offset for every value of the dictionary, so for a shared
+  // dictionary, each chunk pays four bytes per distinct value of the whole column, even for values it does not hold.
+  // Lookups index the offsets by value id directly, which would need a translation if they were sized per chunk.
+  std::vector<ChunkOffset> _value_offsets;
+  std::vector<ChunkOffset> _postings;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(GroupKeyIndex);
+
+}  // namespace opossum
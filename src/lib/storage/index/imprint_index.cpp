@@ -0,0 +1,232 @@
+#include "imprint_index.hpp"
+
+#include <algorithm>
+
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// The bit of an imprint that marks lines with NULLs. It follows the bits of all bins.
+constexpr auto NULL_BIT = uint64_t{1} << 63;
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+ImprintIndex<T>::ImprintIndex(const std::shared_ptr<const AbstractSegment>& segment)
+    : _segment(segment), _rows_per_line(static_cast<ChunkOffset>(CACHE_LINE_SIZE / sizeof(T))) {
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    _rows_per_line = static_cast<ChunkOffset>(CACHE_LINE_SIZE / dictionary_segment->attribute_vector()->width());
+  }
+
+  const auto size = segment->size();
+  const auto stride = std::max(size_t{1}, size / SAMPLE_SIZE);
+  auto sample = std::vector<T>{};
+  sample.reserve(SAMPLE_SIZE + 1);
+  segment_iterate<T>(*segment, [&](const auto& position) {
+    if (!position.is_null && position.chunk_offset % stride == 0) {
+      sample.push_back(position.value);
+    }
+  });
+  std::sort(sample.begin(), sample.end());
+
+  // If the sample has few distinct values, each of them starts a bin of its own. Otherwise, the borders are the
+  // quantiles of the sample, so that each bin holds about as many values. Frequent values span several quantiles,
+  // which are merged into one border.
+  auto distinct_values = sample;
+  distinct_values.erase(std::unique(distinct_values.begin(), distinct_values.end()), distinct_values.end());
+  if (distinct_values.size() <= MAX_BIN_COUNT) {
+    if (!distinct_values.empty()) {
+      _bin_borders.assign(distinct_values.begin() + 1, distinct_values.end());
+    }
+  } else {
+    for (auto bin = size_t{1}; bin < MAX_BIN_COUNT; ++bin) {
+      const auto& border = sample[bin * sample.size() / MAX_BIN_COUNT];
+      if (_bin_borders.empty() || _bin_borders.back() < border) {
+        _bin_borders.push_back(border);
+      }
+    }
+  }
+
+  const auto add_imprint = [&](const uint64_t imprint) {
+    if (!_runs.empty() && _imprints.back() == imprint) {
+      auto& run = _runs.back();
+      if (!run.repeated) {
+        // The last imprint of the run is now shared with the new line and moves into a repeated run.
+        --run.line_count;
+        if (run.line_count == 0) {
+          _runs.pop_back();
+        }
+        _runs.push_back(Run{1, 1});
+      }
+      ++_runs.back().line_count;
+      return;
+    }
+
+    _imprints.push_back(imprint);
+    if (!_runs.empty() && !_runs.back().repeated) {
+      ++_runs.back().line_count;
+    } else {
+      _runs.push_back(Run{1, 0});
+    }
+  };
+
+  auto imprint = uint64_t{0};
+  segment_iterate<T>(*segment, [&](const auto& position) {
+    imprint |= position.is_null ? NULL_BIT : uint64_t{1} << _bin(position.value);
+    if ((position.chunk_offset + 1) % _rows_per_line == 0) {
+      add_imprint(imprint);
+      imprint = 0;
+    }
+  });
+  if (size % _rows_per_line != 0) {
+    add_imprint(imprint);
+  }
+  _imprints.shrink_to_fit();
+  _runs.shrink_to_fit();
+}
+
+template <typename T>
+void ImprintIndex<T>::append_matches(const ScanType scan_type, const AllTypeVariant& search_value,
+                                     const ChunkID chunk_id, PosList& matches) const {
+  if (variant_is_null(search_value)) {
+    return;
+  }
+  const auto value = type_cast<T>(search_value);
+  const auto bin = _bin(value);
+  const auto bin_end = bin_count();
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      _append_lines(
+          _bin_mask(bin, bin + 1), 0, [&](const T& row_value) { return row_value == value; }, chunk_id, matches);
+      return;
+    case ScanType::OpNotEquals:
+      _append_lines(
+          _bin_mask(0, bin_end), _bin_mask(0, bin) | _bin_mask(bin + 1, bin_end),
+          [&](const T& row_value) { return row_value != value; }, chunk_id, matches);
+      return;
+    case ScanType::OpLessThan:
+      _append_lines(
+          _bin_mask(0, bin + 1), _bin_mask(0, bin), [&](const T& row_value) { return row_value < value; }, chunk_id,
+          matches);
+      return;
+    case ScanType::OpLessThanEquals:
+      _append_lines(
+          _bin_mask(0, bin + 1), _bin_mask(0, bin), [&](const T& row_value) { return row_value <= value; }, chunk_id,
+          matches);
+      return;
+    case ScanType::OpGreaterThan:
+      _append_lines(
+          _bin_mask(bin, bin_end), _bin_mask(bin + 1, bin_end), [&](const T& row_value) { return row_value > value; },
+          chunk_id, matches);
+      return;
+    case ScanType::OpGreaterThanEquals:
+      _append_lines(
+          _bin_mask(bin, bin_end), _bin_mask(bin + 1, bin_end), [&](const T& row_value) { return row_value >= value; },
+          chunk_id, matches);
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+template <typename T>
+void ImprintIndex<T>::append_range_matches(const T& min, const T& max, const ChunkID chunk_id,
+                                           PosList& matches) const {
+  if (max < min) {
+    return;
+  }
+  const auto min_bin = _bin(min);
+  const auto max_bin = _bin(max);
+  _append_lines(
+      _bin_mask(min_bin, max_bin + 1), _bin_mask(min_bin + 1, max_bin),
+      [&](const T& row_value) { return min <= row_value && row_value <= max; }, chunk_id, matches);
+}
+
+template <typename T>
+ChunkOffset ImprintIndex<T>::rows_per_line() const {
+  return _rows_per_line;
+}
+
+template <typename T>
+size_t ImprintIndex<T>::bin_count() const {
+  return _bin_borders.size() + 1;
+}
+
+template <typename T>
+size_t ImprintIndex<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _bin_borders.capacity() * sizeof(T) + _imprints.capacity() * sizeof(uint64_t) +
+         _runs.capacity() * sizeof(Run);
+}
+
+template <typename T>
+size_t ImprintIndex<T>::_bin(const T& value) const {
+  return std::upper_bound(_bin_borders.begin(), _bin_borders.end(), value) - _bin_borders.begin();
+}
+
+template <typename T>
+uint64_t ImprintIndex<T>::_bin_mask(const size_t begin_bin, const size_t end_bin) {
+  if (end_bin <= begin_bin) {
+    return 0;
+  }
+  return ((uint64_t{1} << end_bin) - 1) & ~((uint64_t{1} << begin_bin) - 1);
+}
+
+template <typename T>
+template <typename Predicate>
+void ImprintIndex<T>::_append_lines(const uint64_t candidate_bins, const uint64_t inner_bins,
+                                    const Predicate& predicate, const ChunkID chunk_id, PosList& matches) const {
+  const auto size = _segment->size();
+  detail::with_segment_accessor<T>(*_segment, [&](const auto& accessor) {
+    auto line = size_t{0};
+    const auto append_lines = [&](const uint64_t imprint, const size_t line_count) {
+      const auto begin = static_cast<ChunkOffset>(line * _rows_per_line);
+      const auto end = static_cast<ChunkOffset>(std::min(begin + line_count * _rows_per_line, size_t{size}));
+      line += line_count;
+      if ((imprint & candidate_bins) == 0) {
+        return;
+      }
+
+      // The NULL bit is never an inner bin, so lines with NULLs are always filtered.
+      if ((imprint & ~inner_bins) == 0) {
+        for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+          matches.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+        return;
+      }
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+        const auto position = accessor(chunk_offset);
+        if (!position.is_null && predicate(position.value)) {
+          matches.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    };
+
+    auto imprint_index = size_t{0};
+    for (const auto& run : _runs) {
+      if (run.repeated) {
+        append_lines(_imprints[imprint_index++], run.line_count);
+        continue;
+      }
+      for (auto run_line = size_t{0}; run_line < run.line_count; ++run_line) {
+        append_lines(_imprints[imprint_index++], 1);
+      }
+    }
+  });
+}
+
+template class ImprintIndex<int32_t>;
+template class ImprintIndex<int64_t>;
+template class ImprintIndex<float>;
+template class ImprintIndex<double>;
+template class ImprintIndex<int8_t>;
+template class ImprintIndex<int16_t>;
+template class ImprintIndex<Date>;
+template class ImprintIndex<Timestamp>;
+template class ImprintIndex<Decimal>;
+
+}  // namespace opossum
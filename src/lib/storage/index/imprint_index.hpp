@@ -0,0 +1,80 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+#include "storage/abstract_segment.hpp"
+
+namespace opossum {
+
+// An ImprintIndex (column imprints) stores a bit vector for each cache line of a segment. The value range of the
+// segment is split into up to 63 bins, whose borders are the quantiles of a sample of its values, and each bit of an
+// imprint tells whether the cache line holds a value of the corresponding bin. The last bit marks lines with NULLs.
+// A query computes the bins that can hold matching values and only reads the cache lines whose imprints share a bin
+// with them, while lines whose bins all lie within the queried range are taken without comparing their values. For a
+// ValueSegment, a cache line holds 64 / sizeof(T) values, for a DictionarySegment 64 / width value ids. Consecutive
+// equal imprints, which are common in clustered columns, are stored once. As the bins are fixed when the index is
+// built, it is meant for immutable segments of fixed-width types.
+template <typename T>
+class ImprintIndex : public BaseIndex {
+ public:
+  static constexpr auto CACHE_LINE_SIZE = size_t{64};
+  static constexpr auto MAX_BIN_COUNT = size_t{63};
+  // The number of values from which the bin borders are chosen.
+  static constexpr auto SAMPLE_SIZE = size_t{2048};
+
+  explicit ImprintIndex(const std::shared_ptr<const AbstractSegment>& segment);
+
+  void append_matches(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+                      PosList& matches) const final;
+
+  // Appends the rows whose values are in [min, max] to matches, with the given chunk id.
+  void append_range_matches(const T& min, const T& max, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns the number of rows covered by one imprint.
+  ChunkOffset rows_per_line() const;
+
+  // Returns the number of bins, which is lower than MAX_BIN_COUNT if the sample has few distinct values.
+  size_t bin_count() const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Either line_count lines whose imprints are stored one after another, or line_count lines that share one imprint.
+  struct Run {
+    uint32_t line_count : 31;
+    uint32_t repeated : 1;
+  };
+
+  // Returns the bin of a value other than NULL.
+  size_t _bin(const T& value) const;
+
+  // Returns a mask of the bins [begin_bin, end_bin), or 0 if end_bin <= begin_bin.
+  static uint64_t _bin_mask(const size_t begin_bin, const size_t end_bin);
+
+  // Appends the rows of all lines whose imprints share a bin with candidate_bins. Lines whose imprints only have bins
+  // in inner_bins are appended as a whole, all others are filtered with the predicate.
+  template <typename Predicate>
+  void _append_lines(const uint64_t candidate_bins, const uint64_t inner_bins, const Predicate& predicate,
+                     const ChunkID chunk_id, PosList& matches) const;
+
+  const std::shared_ptr<const AbstractSegment> _segment;
+  ChunkOffset _rows_per_line;
+  // Values below the first border are in bin 0, values in [_bin_borders[i], _bin_borders[i + 1]) in bin i + 1.
+  std::vector<T> _bin_borders;
+  std::vector<uint64_t> _imprints;
+  std::vector<Run> _runs;
+};
+
+extern template class ImprintIndex<int32_t>;
+extern template class ImprintIndex<int64_t>;
+extern template class ImprintIndex<float>;
+extern template class ImprintIndex<double>;
+extern template class ImprintIndex<int8_t>;
+extern template class ImprintIndex<int16_t>;
+extern template class ImprintIndex<Date>;
+extern template class ImprintIndex<Timestamp>;
+extern template class ImprintIndex<Decimal>;
+
+}  // namespace opossum
@@ -7,6 +7,7 @@ namespace opossum {
 class Table;
 
 // ReferenceSegment is a specific segment type that stores all its values as position list of a referenced column.
+// NULL_ROW_IDs in the position list represent NULL values.
 class ReferenceSegment : public AbstractSegment {
  public:
   // Creates a reference segment. The parameters specify the positions and the referenced column.
@@ -23,7 +24,13 @@ class ReferenceSegment : public AbstractSegment {
 
   ColumnID referenced_column_id() const;
 
+  // Returns the memory usage of the pos list. The referenced table is not included.
   size_t estimate_memory_usage() const final;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
 }  // namespace opossum
@@ -0,0 +1,121 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Can't encode abstract segment, because it is no value segment.");
+
+  const auto& values = value_segment->values();
+  const auto value_segment_size = value_segment->size();
+
+  // A new run starts whenever the NULL flag or the value changes. NULL runs store a default-constructed value.
+  for (auto index = ChunkOffset{0}; index < value_segment_size; ++index) {
+    const auto is_null = value_segment->is_null(index);
+    if (!_end_positions.empty() && _null_values.back() == is_null && (is_null || _values.back() == values[index])) {
+      _end_positions.back() = index;
+      continue;
+    }
+
+    _values.push_back(is_null ? T{} : T{values[index]});
+    _null_values.push_back(is_null);
+    _end_positions.push_back(index);
+  }
+
+  _values.shrink_to_fit();
+  _null_values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  if (return_value) {
+    return *return_value;
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto return_value = get_typed_value(chunk_offset);
+  Assert(return_value.has_value(), "Value at position: " + std::to_string(chunk_offset) + " is NULL!");
+  return *return_value;
+}
+
+template <typename T>
+std::optional<T> RunLengthSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Chunk offset " + std::to_string(chunk_offset) + " is out of range.");
+  // The run containing the offset is the first one that ends at or after it.
+  const auto run_iterator = std::lower_bound(_end_positions.begin(), _end_positions.end(), chunk_offset);
+  const auto run_index = std::distance(_end_positions.begin(), run_iterator);
+  if (_null_values[run_index]) {
+    return std::nullopt;
+  }
+  return _values[run_index];
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::vector<bool>& RunLengthSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::run_count() const {
+  return static_cast<ChunkOffset>(_end_positions.size());
+}
+
+template <typename T>
+void RunLengthSegment<T>::materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out,
+                                            ValidityBitmap* nulls) const {
+  Assert(begin <= end && end <= size(), "Invalid range for RunLengthSegment::materialize_range.");
+  if (nulls) {
+    nulls->assign(end - begin, true);
+  }
+
+  const auto first_run = std::lower_bound(_end_positions.begin(), _end_positions.end(), begin);
+  auto run_index = static_cast<size_t>(std::distance(_end_positions.begin(), first_run));
+  for (auto run_begin = begin; run_begin < end; ++run_index) {
+    const auto run_end = std::min(static_cast<ChunkOffset>(_end_positions[run_index] + 1), end);
+    std::fill(out + (run_begin - begin), out + (run_end - begin), _values[run_index]);
+    if (nulls && _null_values[run_index]) {
+      for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+        nulls->set_valid(chunk_offset - begin, false);
+      }
+    }
+    run_begin = run_end;
+  }
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  if (_end_positions.empty()) {
+    return 0;
+  }
+  return _end_positions.back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(T) * _values.size() + sizeof(ChunkOffset) * _end_positions.size() + (_null_values.size() + 7) / 8;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
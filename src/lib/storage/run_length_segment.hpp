@@ -0,0 +1,57 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+#include "validity_bitmap.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a segment type that stores sequences of equal values (runs) only once. For each run, it keeps the
+// value, whether the run consists of NULLs, and the (inclusive) chunk offset at which the run ends. This pays off for
+// sorted or clustered columns with few distinct values, e.g., status or flag columns. Operators can evaluate a
+// predicate once per run instead of once per row.
+template <typename T>
+class RunLengthSegment : public AbstractSegment {
+ public:
+  // Creates a RunLengthSegment from a given value segment.
+  explicit RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the value of each run. The value of a NULL run is undefined.
+  const std::vector<T>& values() const;
+
+  // Returns whether each run consists of NULL values.
+  const std::vector<bool>& null_values() const;
+
+  // Returns the last chunk offset of each run. The entries are strictly increasing and the last entry is size() - 1.
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // Writes the values of the rows [begin, end) to out, which has to hold end - begin entries. Each run is filled at
+  // once. If nulls is given, it is refilled with the validity of the rows. The value of a NULL row is undefined.
+  void materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out, ValidityBitmap* nulls) const;
+
+  // Returns the number of runs.
+  ChunkOffset run_count() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<T> _values;
+  std::vector<bool> _null_values;
+  std::vector<ChunkOffset> _end_positions;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,166 @@
+#include "segment_encoding.hpp"
+
+#include <ostream>
+
+#include <boost/hana/for_each.hpp>
+
+#include "alp_segment.hpp"
+#include "bit_packed_vector.hpp"
+#include "dictionary_segment.hpp"
+#include "encoding_advisor.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+bool operator==(const SegmentEncodingSpec& lhs, const SegmentEncodingSpec& rhs) {
+  return lhs.encoding_type == rhs.encoding_type && lhs.vector_compression_type == rhs.vector_compression_type &&
+         lhs.use_delta_encoding == rhs.use_delta_encoding && lhs.use_shared_dictionary == rhs.use_shared_dictionary;
+}
+
+std::ostream& operator<<(std::ostream& stream, const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return stream << "Unencoded";
+    case EncodingType::Dictionary:
+      return stream << "Dictionary";
+    case EncodingType::RunLength:
+      return stream << "RunLength";
+    case EncodingType::FrameOfReference:
+      return stream << "FrameOfReference";
+    case EncodingType::FSST:
+      return stream << "FSST";
+    case EncodingType::ALP:
+      return stream << "ALP";
+    case EncodingType::Auto:
+      return stream << "Auto";
+  }
+  Fail("Unknown encoding type.");
+}
+
+std::ostream& operator<<(std::ostream& stream, const SegmentEncodingSpec& spec) {
+  stream << spec.encoding_type;
+  if (spec.encoding_type == EncodingType::Dictionary) {
+    const auto is_bit_packed = spec.vector_compression_type == VectorCompressionType::BitPacked;
+    stream << (is_bit_packed ? " (BitPacked)" : " (FixedWidthInteger)");
+    if (spec.use_shared_dictionary) {
+      stream << " (Shared)";
+    }
+  } else if (spec.encoding_type == EncodingType::FrameOfReference && spec.use_delta_encoding) {
+    stream << " (Delta)";
+  }
+  return stream;
+}
+
+bool encoding_supports_data_type(const EncodingType encoding_type, const DataType data_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+    case EncodingType::Dictionary:
+    case EncodingType::RunLength:
+    case EncodingType::Auto:
+      return true;
+    case EncodingType::FrameOfReference:
+      return data_type == DataType::Int || data_type == DataType::Long;
+    case EncodingType::FSST:
+      return data_type == DataType::String;
+    case EncodingType::ALP:
+      return data_type == DataType::Float || data_type == DataType::Double;
+  }
+  Fail("Unknown encoding type.");
+}
+
+std::shared_ptr<AbstractSegment> encode_segment(const std::shared_ptr<AbstractSegment>& segment,
+                                                const DataType data_type, const SegmentEncodingSpec& spec,
+                                                const size_t max_thread_count) {
+  if (spec.encoding_type == EncodingType::Auto) {
+    return encode_segment(segment, data_type, choose_segment_encoding(segment, data_type), max_thread_count);
+  }
+  Assert(encoding_supports_data_type(spec.encoding_type, data_type),
+         "Encoding does not support data type " + data_type_to_string(data_type) + ".");
+
+  auto encoded_segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    switch (spec.encoding_type) {
+      case EncodingType::Unencoded:
+        encoded_segment = segment;
+        return;
+      case EncodingType::Dictionary:
+        encoded_segment = std::make_shared<DictionarySegment<ColumnDataType>>(segment, spec.vector_compression_type,
+                                                                              max_thread_count);
+        return;
+      case EncodingType::RunLength:
+        encoded_segment = std::make_shared<RunLengthSegment<ColumnDataType>>(segment);
+        return;
+      case EncodingType::FrameOfReference:
+        if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+          encoded_segment = std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(segment, spec.use_delta_encoding);
+        }
+        return;
+      case EncodingType::FSST:
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          encoded_segment = std::make_shared<FSSTSegment>(segment);
+        }
+        return;
+      case EncodingType::ALP:
+        if constexpr (std::is_floating_point_v<ColumnDataType>) {
+          encoded_segment = std::make_shared<ALPSegment<ColumnDataType>>(segment);
+        }
+        return;
+      case EncodingType::Auto:
+        Fail("Auto encoding has to be resolved before.");
+    }
+  });
+  return encoded_segment;
+}
+
+SegmentEncodingSpec get_segment_encoding_spec(const std::shared_ptr<const AbstractSegment>& segment) {
+  if (std::dynamic_pointer_cast<const BaseValueSegment>(segment)) {
+    return {EncodingType::Unencoded};
+  }
+  if (std::dynamic_pointer_cast<const FSSTSegment>(segment)) {
+    return {EncodingType::FSST};
+  }
+
+  auto spec = std::optional<SegmentEncodingSpec>{};
+  hana::for_each(types, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if (spec) {
+      return;
+    }
+
+    if (const auto dictionary_segment =
+                   std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+      const auto is_bit_packed =
+          static_cast<bool>(std::dynamic_pointer_cast<const BitPackedVector>(dictionary_segment->attribute_vector()));
+      spec = SegmentEncodingSpec{EncodingType::Dictionary, is_bit_packed ? VectorCompressionType::BitPacked
+                                                                         : VectorCompressionType::FixedWidthInteger};
+      spec->use_shared_dictionary = dictionary_segment->has_shared_dictionary();
+    } else if (std::dynamic_pointer_cast<const RunLengthSegment<ColumnDataType>>(segment)) {
+      spec = SegmentEncodingSpec{EncodingType::RunLength};
+    }
+
+    if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+      if (const auto frame_of_reference_segment =
+              std::dynamic_pointer_cast<const FrameOfReferenceSegment<ColumnDataType>>(segment)) {
+        spec = SegmentEncodingSpec{EncodingType::FrameOfReference};
+        spec->use_delta_encoding = frame_of_reference_segment->is_delta_encoded();
+      }
+    }
+
+    if constexpr (std::is_floating_point_v<ColumnDataType>) {
+      if (std::dynamic_pointer_cast<const ALPSegment<ColumnDataType>>(segment)) {
+        spec = SegmentEncodingSpec{EncodingType::ALP};
+      }
+    }
+  });
+
+  Assert(spec, "Unknown segment type.");
+  return *spec;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Encodings that Table::compress_chunk can apply to a ValueSegment. Auto lets the encoding advisor pick one of the
+// others based on a sample of the segment (see encoding_advisor.hpp).
+enum class EncodingType { Unencoded, Dictionary, RunLength, FrameOfReference, FSST, ALP, Auto };
+
+// Describes how the segments of a column are encoded. vector_compression_type and use_shared_dictionary only apply to
+// DictionarySegments, use_delta_encoding only to FrameOfReferenceSegments. With use_shared_dictionary, the segments of
+// the column reference one dictionary. This makes value ids comparable across chunks and stores each distinct value
+// once per column instead of once per chunk. Chunks with values that the shared dictionary lacks keep a dictionary of
+// their own until Table::compress_chunk merges them in (see Table::MAX_PENDING_DICTIONARY_SHARE), so segments have to
+// be checked with DictionarySegment::has_shared_dictionary. encode_segment itself always builds a dictionary for the
+// single segment.
+struct SegmentEncodingSpec {
+  EncodingType encoding_type{EncodingType::Dictionary};
+  VectorCompressionType vector_compression_type{VectorCompressionType::FixedWidthInteger};
+  bool use_delta_encoding{false};
+  bool use_shared_dictionary{false};
+};
+
+bool operator==(const SegmentEncodingSpec& lhs, const SegmentEncodingSpec& rhs);
+
+std::ostream& operator<<(std::ostream& stream, const EncodingType encoding_type);
+std::ostream& operator<<(std::ostream& stream, const SegmentEncodingSpec& spec);
+
+// Returns whether segments of the given data type can be encoded with the given encoding.
+bool encoding_supports_data_type(const EncodingType encoding_type, const DataType data_type);
+
+// Encodes a ValueSegment of the given data type according to the spec. If the spec is Auto, the encoding advisor
+// chooses the encoding first. Unencoded returns the given segment itself. max_thread_count limits the threads that an
+// encoding may start (see DictionarySegment), 0 allows one thread per core.
+std::shared_ptr<AbstractSegment> encode_segment(const std::shared_ptr<AbstractSegment>& segment,
+                                                const DataType data_type, const SegmentEncodingSpec& spec,
+                                                const size_t max_thread_count = 0);
+
+// Returns the spec that describes how a given segment is encoded. This allows to verify the choices of the advisor.
+SegmentEncodingSpec get_segment_encoding_spec(const std::shared_ptr<const AbstractSegment>& segment);
+
+}  // namespace opossum
@@ -0,0 +1,383 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "alp_segment.hpp"
+#include "bit_packed_vector.hpp"
+#include "dictionary_segment.hpp"
+#include "fixed_width_integer_vector.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "reference_segment.hpp"
+#include "run_length_segment.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// Strings are passed as string_views into the segment or into a buffer of the iteration, all other types by value.
+template <typename T>
+using SegmentValue = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+// A row of a segment as passed to the functor of segment_iterate. The value of a NULL row is default-constructed.
+template <typename T>
+struct SegmentPosition {
+  SegmentValue<T> value;
+  bool is_null;
+  ChunkOffset chunk_offset;
+};
+
+namespace detail {
+
+// Encoded segments that only offer a bulk decode are decoded in blocks of this many rows.
+constexpr auto SEGMENT_ITERATE_BLOCK_SIZE = ChunkOffset{1024};
+
+// Calls the functor with the attribute vector cast to its concrete type. As both vector types are final, their member
+// functions are called without virtual dispatch.
+template <typename Functor>
+void resolve_attribute_vector(const AbstractAttributeVector& attribute_vector, const Functor& functor) {
+  if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint8_t>*>(&attribute_vector)) {
+    functor(*vector);
+  } else if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint16_t>*>(&attribute_vector)) {
+    functor(*vector);
+  } else if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint32_t>*>(&attribute_vector)) {
+    functor(*vector);
+  } else if (const auto* vector = dynamic_cast<const BitPackedVector*>(&attribute_vector)) {
+    functor(*vector);
+  } else {
+    Fail("Unknown attribute vector type.");
+  }
+}
+
+// Returns the values of a dictionary such that a value id minus the offset of the first value id indexes them.
+// Front-coded string dictionaries are decoded once for this.
+template <typename T>
+decltype(auto) dictionary_values(const DictionarySegment<T>& segment) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return segment.dictionary().values();
+  } else {
+    return segment.dictionary();
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_value_segment(const ValueSegment<T>& segment, const Functor& functor) {
+  const auto& values = segment.values();
+  const auto size = segment.size();
+  if (!segment.is_nullable()) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      functor(SegmentPosition<T>{values[chunk_offset], false, chunk_offset});
+    }
+    return;
+  }
+
+  const auto& null_values = segment.null_values();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    const auto is_null = null_values.is_null(chunk_offset);
+    functor(SegmentPosition<T>{is_null ? SegmentValue<T>{} : SegmentValue<T>{values[chunk_offset]}, is_null,
+                               chunk_offset});
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_dictionary_segment(const DictionarySegment<T>& segment, const Functor& functor) {
+  const auto& values = dictionary_values(segment);
+  const auto null_value_id = segment.null_value_id();
+  const auto first_value_id = ValueID::base_type{null_value_id == INVALID_VALUE_ID ? 0u : 1u};
+  const auto call_functor = [&](const ValueID::base_type value_id, const ChunkOffset chunk_offset) {
+    if (value_id == null_value_id) {
+      functor(SegmentPosition<T>{SegmentValue<T>{}, true, chunk_offset});
+    } else {
+      functor(SegmentPosition<T>{values[value_id - first_value_id], false, chunk_offset});
+    }
+  };
+
+  resolve_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    using AttributeVector = std::decay_t<decltype(attribute_vector)>;
+    const auto size = static_cast<ChunkOffset>(attribute_vector.size());
+    if constexpr (std::is_same_v<AttributeVector, BitPackedVector>) {
+      auto value_ids = std::array<ValueID::base_type, SEGMENT_ITERATE_BLOCK_SIZE>{};
+      for (auto begin = ChunkOffset{0}; begin < size; begin += SEGMENT_ITERATE_BLOCK_SIZE) {
+        const auto end = std::min(begin + SEGMENT_ITERATE_BLOCK_SIZE, size);
+        attribute_vector.decode(begin, end, value_ids.data());
+        for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+          call_functor(value_ids[chunk_offset - begin], chunk_offset);
+        }
+      }
+    } else {
+      const auto& value_ids = attribute_vector.values();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+        call_functor(value_ids[chunk_offset], chunk_offset);
+      }
+    }
+  });
+}
+
+template <typename T, typename Functor>
+void iterate_run_length_segment(const RunLengthSegment<T>& segment, const Functor& functor) {
+  const auto& values = segment.values();
+  const auto& null_values = segment.null_values();
+  const auto& end_positions = segment.end_positions();
+  auto chunk_offset = ChunkOffset{0};
+  for (auto run_index = size_t{0}; run_index < end_positions.size(); ++run_index) {
+    const auto position = SegmentPosition<T>{values[run_index], null_values[run_index], ChunkOffset{0}};
+    for (; chunk_offset <= end_positions[run_index]; ++chunk_offset) {
+      functor(SegmentPosition<T>{position.value, position.is_null, chunk_offset});
+    }
+  }
+}
+
+// Iterates over segments that decode blocks of values into a buffer, i.e., FrameOfReferenceSegments and ALPSegments.
+template <typename T, typename Segment, typename Functor>
+void iterate_decoded_segment(const Segment& segment, const Functor& functor) {
+  const auto size = segment.size();
+  auto values = std::array<T, SEGMENT_ITERATE_BLOCK_SIZE>{};
+  for (auto begin = ChunkOffset{0}; begin < size; begin += SEGMENT_ITERATE_BLOCK_SIZE) {
+    const auto end = std::min(begin + SEGMENT_ITERATE_BLOCK_SIZE, size);
+    segment.decode(begin, end, values.data());
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      const auto is_null = segment.is_null(chunk_offset);
+      functor(SegmentPosition<T>{is_null ? T{} : values[chunk_offset - begin], is_null, chunk_offset});
+    }
+  }
+}
+
+// Calls the functor with a callable that returns the SegmentPosition of a given chunk offset of the segment. The
+// callable is specific to the concrete segment type. It is used to follow the pos list of a ReferenceSegment. String
+// values are only valid until the callable is called again.
+template <typename T, typename Functor>
+void with_segment_accessor(const AbstractSegment& segment, const Functor& functor) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto& values = value_segment->values();
+    functor([&](const ChunkOffset chunk_offset) {
+      const auto is_null = value_segment->is_null(chunk_offset);
+      return SegmentPosition<T>{is_null ? SegmentValue<T>{} : SegmentValue<T>{values[chunk_offset]}, is_null,
+                                chunk_offset};
+    });
+    return;
+  }
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = dictionary_segment->dictionary();
+    const auto null_value_id = dictionary_segment->null_value_id();
+    const auto first_value_id = ValueID::base_type{null_value_id == INVALID_VALUE_ID ? 0u : 1u};
+    resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      // Front-coded strings are decoded into the buffer, as decoding the whole dictionary does not pay off for a few
+      // positions.
+      auto buffer = std::string{};
+      functor([&](const ChunkOffset chunk_offset) {
+        const auto value_id = static_cast<ValueID::base_type>(attribute_vector.get(chunk_offset));
+        if (value_id == null_value_id) {
+          return SegmentPosition<T>{SegmentValue<T>{}, true, chunk_offset};
+        }
+        if constexpr (std::is_same_v<T, std::string>) {
+          buffer = dictionary[value_id - first_value_id];
+          return SegmentPosition<T>{buffer, false, chunk_offset};
+        } else {
+          return SegmentPosition<T>{dictionary[value_id - first_value_id], false, chunk_offset};
+        }
+      });
+    });
+    return;
+  }
+
+  // All other segment types provide get_typed_value.
+  const auto call_with_typed_accessor = [&](const auto& typed_segment) {
+    auto buffer = std::optional<T>{};
+    functor([&](const ChunkOffset chunk_offset) {
+      buffer = typed_segment.get_typed_value(chunk_offset);
+      return SegmentPosition<T>{buffer ? SegmentValue<T>{*buffer} : SegmentValue<T>{}, !buffer, chunk_offset};
+    });
+  };
+
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    call_with_typed_accessor(*run_length_segment);
+    return;
+  }
+  if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      call_with_typed_accessor(*frame_of_reference_segment);
+      return;
+    }
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (const auto* alp_segment = dynamic_cast<const ALPSegment<T>*>(&segment)) {
+      call_with_typed_accessor(*alp_segment);
+      return;
+    }
+  }
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (const auto* fsst_segment = dynamic_cast<const FSSTSegment*>(&segment)) {
+      call_with_typed_accessor(*fsst_segment);
+      return;
+    }
+  }
+  Fail("Unknown segment type.");
+}
+
+// Iterates over the positions [begin, end) of the pos list of a ReferenceSegment.
+template <typename T, typename Functor>
+void iterate_reference_segment(const ReferenceSegment& segment, const ChunkOffset begin, const ChunkOffset end,
+                               const Functor& functor) {
+  const auto& pos_list = *segment.pos_list();
+  const auto& table = *segment.referenced_table();
+  const auto column_id = segment.referenced_column_id();
+  Assert(begin <= end && end <= pos_list.size(), "Invalid range for a ReferenceSegment.");
+
+  // Consecutive positions in the same chunk, which may be interrupted by NULL_ROW_IDs, are resolved together.
+  auto run_begin = begin;
+  while (run_begin < end && pos_list[run_begin].is_null()) {
+    functor(SegmentPosition<T>{SegmentValue<T>{}, true, run_begin});
+    ++run_begin;
+  }
+  while (run_begin < end) {
+    const auto chunk_id = pos_list[run_begin].chunk_id;
+    auto run_end = run_begin + 1;
+    while (run_end < end && (pos_list[run_end].is_null() || pos_list[run_end].chunk_id == chunk_id)) {
+      ++run_end;
+    }
+
+    const auto& referenced_segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+    Assert(!dynamic_cast<const ReferenceSegment*>(&referenced_segment), "ReferenceSegments cannot be nested.");
+    with_segment_accessor<T>(referenced_segment, [&](const auto& accessor) {
+      for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+        const auto row_id = pos_list[chunk_offset];
+        if (row_id.is_null()) {
+          functor(SegmentPosition<T>{SegmentValue<T>{}, true, chunk_offset});
+          continue;
+        }
+        auto position = accessor(row_id.chunk_offset);
+        position.chunk_offset = chunk_offset;
+        functor(position);
+      }
+    });
+    run_begin = run_end;
+  }
+}
+
+}  // namespace detail
+
+// Calls the functor with a SegmentPosition<T> for each row of the segment, in order. T has to be the data type of the
+// column. Unlike AbstractSegment::operator[], which is a virtual call returning a variant per row, the concrete type
+// of the segment (and of the attribute vector of a DictionarySegment) is resolved once. Each type has its own loop,
+// into which the functor is inlined. For ReferenceSegments, the chunk_offset is the position in the pos list and the
+// referenced segments are resolved once per run of positions in the same chunk. String values are only valid during
+// the call of the functor.
+//
+// Example:
+//   auto sum = int64_t{0};
+//   segment_iterate<int32_t>(segment, [&](const auto& position) {
+//     if (!position.is_null) {
+//       sum += position.value;
+//     }
+//   });
+template <typename T, typename Functor>
+void segment_iterate(const AbstractSegment& segment, const Functor& functor) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    detail::iterate_value_segment(*value_segment, functor);
+    return;
+  }
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    detail::iterate_dictionary_segment(*dictionary_segment, functor);
+    return;
+  }
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    detail::iterate_reference_segment<T>(*reference_segment, ChunkOffset{0}, reference_segment->size(), functor);
+    return;
+  }
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    detail::iterate_run_length_segment(*run_length_segment, functor);
+    return;
+  }
+  if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      detail::iterate_decoded_segment<T>(*frame_of_reference_segment, functor);
+      return;
+    }
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (const auto* alp_segment = dynamic_cast<const ALPSegment<T>*>(&segment)) {
+      detail::iterate_decoded_segment<T>(*alp_segment, functor);
+      return;
+    }
+  }
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (const auto* fsst_segment = dynamic_cast<const FSSTSegment*>(&segment)) {
+      // Each value is decompressed into the buffer, which the string_view of the previous value pointed to.
+      auto buffer = std::string{};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < fsst_segment->size(); ++chunk_offset) {
+        const auto is_null = fsst_segment->is_null(chunk_offset);
+        if (!is_null) {
+          buffer = fsst_segment->get(chunk_offset);
+        }
+        functor(SegmentPosition<T>{is_null ? std::string_view{} : std::string_view{buffer}, is_null, chunk_offset});
+      }
+      return;
+    }
+  }
+  Fail("Unknown segment type.");
+}
+
+// Writes the values of the rows [begin, end) of a segment to out, which has to hold end - begin entries. If nulls is
+// given, it is refilled with the validity of these rows. The value of a NULL row is undefined. Like segment_iterate,
+// this resolves the segment type once. Encoded segments then decode the whole range at once, so that operators can
+// process a segment in batches of a few thousand rows without any per-row dispatch.
+template <typename T>
+void materialize_range(const AbstractSegment& segment, const ChunkOffset begin, const ChunkOffset end, T* out,
+                       ValidityBitmap* nulls) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    value_segment->materialize_range(begin, end, out, nulls);
+    return;
+  }
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    dictionary_segment->materialize_range(begin, end, out, nulls);
+    return;
+  }
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    if (nulls) {
+      nulls->assign(end - begin, true);
+    }
+    detail::iterate_reference_segment<T>(*reference_segment, begin, end, [&](const auto& position) {
+      if (position.is_null) {
+        if (nulls) {
+          nulls->set_valid(position.chunk_offset - begin, false);
+        }
+        return;
+      }
+      out[position.chunk_offset - begin] = T{position.value};
+    });
+    return;
+  }
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    run_length_segment->materialize_range(begin, end, out, nulls);
+    return;
+  }
+  if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      frame_of_reference_segment->materialize_range(begin, end, out, nulls);
+      return;
+    }
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (const auto* alp_segment = dynamic_cast<const ALPSegment<T>*>(&segment)) {
+      alp_segment->materialize_range(begin, end, out, nulls);
+      return;
+    }
+  }
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (const auto* fsst_segment = dynamic_cast<const FSSTSegment*>(&segment)) {
+      fsst_segment->materialize_range(begin, end, out, nulls);
+      return;
+    }
+  }
+  Fail("Unknown segment type.");
+}
+
+}  // namespace opossum
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "segment_iterate.hpp"
+
+namespace opossum {
+
+// Returns the order of the values of a segment, or std::nullopt if it is not sorted. NULLs have to come first (see
+// SortMode). Segments with a single distinct value are considered to be sorted in ascending order.
+template <typename T>
+std::optional<SortMode> detect_sort_mode(const AbstractSegment& segment) {
+  auto ascending = true;
+  auto descending = true;
+  auto previous_value = std::optional<T>{};
+  auto null_after_value = false;
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null) {
+      null_after_value |= previous_value.has_value();
+      return;
+    }
+    if (previous_value) {
+      ascending &= !(position.value < *previous_value);
+      descending &= !(*previous_value < position.value);
+    }
+    // Strings are only copied when they differ from the previous value.
+    if (!previous_value || !(*previous_value == position.value)) {
+      previous_value = T{position.value};
+    }
+  });
+
+  if (null_after_value) {
+    return std::nullopt;
+  }
+  if (ascending) {
+    return SortMode::Ascending;
+  }
+  if (descending) {
+    return SortMode::Descending;
+  }
+  return std::nullopt;
+}
+
+// Finds the rows of a sorted segment that satisfy `value <scan_type> search_value` with binary searches instead of
+// comparing each row, and calls the functor with the range [begin, end) of these rows. Except for OpNotEquals, which
+// matches the values before and after the equal ones, the rows form a single range. Empty ranges are skipped. The
+// segment may use any encoding, but cannot be a ReferenceSegment, as the order of its pos list is unknown.
+//
+// Example:
+//   sorted_segment_search<int32_t>(segment, SortMode::Ascending, ScanType::OpGreaterThan, 2023,
+//                                  [&](const auto begin, const auto end) {
+//     for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+//       matches.emplace_back(RowID{chunk_id, chunk_offset});
+//     }
+//   });
+template <typename T, typename Functor>
+void sorted_segment_search(const AbstractSegment& segment, const SortMode sort_mode, const ScanType scan_type,
+                           const T& search_value, const Functor& functor) {
+  detail::with_segment_accessor<T>(segment, [&](const auto& accessor) {
+    // Returns the first row in [begin, end) for which the predicate is false. It has to be true for all rows before.
+    const auto partition_point = [&](ChunkOffset begin, ChunkOffset end, const auto& predicate) {
+      while (begin < end) {
+        const auto middle = begin + (end - begin) / 2;
+        if (predicate(accessor(middle))) {
+          begin = middle + 1;
+        } else {
+          end = middle;
+        }
+      }
+      return begin;
+    };
+
+    const auto size = segment.size();
+    const auto values_begin =
+        partition_point(ChunkOffset{0}, size, [](const auto& position) { return position.is_null; });
+
+    // The equal values are in [equal_begin, equal_end). In ascending order, the smaller values come before them.
+    const auto ascending = sort_mode == SortMode::Ascending;
+    const auto equal_begin = partition_point(values_begin, size, [&](const auto& position) {
+      return ascending ? position.value < search_value : search_value < position.value;
+    });
+    const auto equal_end = partition_point(equal_begin, size, [&](const auto& position) {
+      return ascending ? !(search_value < position.value) : !(position.value < search_value);
+    });
+
+    const auto call_functor = [&](const ChunkOffset begin, const ChunkOffset end) {
+      if (begin < end) {
+        functor(begin, end);
+      }
+    };
+    const auto by_sort_mode = [&](const auto ascending_range, const auto descending_range) {
+      return ascending ? ascending_range : descending_range;
+    };
+    const auto before_equal = std::make_pair(values_begin, equal_begin);
+    const auto after_equal = std::make_pair(equal_end, size);
+    const auto up_to_equal = std::make_pair(values_begin, equal_end);
+    const auto from_equal = std::make_pair(equal_begin, size);
+
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        call_functor(equal_begin, equal_end);
+        return;
+      case ScanType::OpNotEquals:
+        call_functor(before_equal.first, before_equal.second);
+        call_functor(after_equal.first, after_equal.second);
+        return;
+      case ScanType::OpLessThan: {
+        const auto range = by_sort_mode(before_equal, after_equal);
+        call_functor(range.first, range.second);
+        return;
+      }
+      case ScanType::OpLessThanEquals: {
+        const auto range = by_sort_mode(up_to_equal, from_equal);
+        call_functor(range.first, range.second);
+        return;
+      }
+      case ScanType::OpGreaterThan: {
+        const auto range = by_sort_mode(after_equal, before_equal);
+        call_functor(range.first, range.second);
+        return;
+      }
+      case ScanType::OpGreaterThanEquals: {
+        const auto range = by_sort_mode(from_equal, up_to_equal);
+        call_functor(range.first, range.second);
+        return;
+      }
+    }
+    Fail("Unknown scan type.");
+  });
+}
+
+}  // namespace opossum
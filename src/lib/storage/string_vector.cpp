@@ -0,0 +1,107 @@
+#include "string_vector.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace opossum {
+
+StringVector::StringVector(const std::vector<std::string>& values) {
+  reserve(values.size());
+  for (const auto& value : values) {
+    push_back(value);
+  }
+}
+
+StringVector::StringVector(const StringVector& other) {
+  reserve(other.size());
+  for (const auto value : other) {
+    push_back(value);
+  }
+}
+
+StringVector& StringVector::operator=(const StringVector& other) {
+  if (this != &other) {
+    *this = StringVector{other};
+  }
+  return *this;
+}
+
+StringVector::StringVector(StringVector&& other) noexcept
+    : _strings(std::move(other._strings)),
+      _pages(std::move(other._pages)),
+      _page_position(std::exchange(other._page_position, nullptr)),
+      _page_remaining_bytes(std::exchange(other._page_remaining_bytes, 0)),
+      _arena_bytes(std::exchange(other._arena_bytes, 0)) {
+  other._strings.clear();
+  other._pages.clear();
+}
+
+StringVector& StringVector::operator=(StringVector&& other) noexcept {
+  if (this != &other) {
+    _strings = std::move(other._strings);
+    _pages = std::move(other._pages);
+    _page_position = std::exchange(other._page_position, nullptr);
+    _page_remaining_bytes = std::exchange(other._page_remaining_bytes, 0);
+    _arena_bytes = std::exchange(other._arena_bytes, 0);
+    other._strings.clear();
+    other._pages.clear();
+  }
+  return *this;
+}
+
+const char* StringVector::_copy_to_arena(const std::string_view value) {
+  if (value.size() > _page_remaining_bytes) {
+    const auto next_page_size = _pages.empty() ? MIN_PAGE_SIZE : std::min(_arena_bytes * 2, MAX_PAGE_SIZE);
+    const auto page_size = std::max(next_page_size, value.size());
+    _pages.push_back(std::make_unique<char[]>(page_size));
+    _page_position = _pages.back().get();
+    _page_remaining_bytes = page_size;
+    _arena_bytes += page_size;
+  }
+
+  auto* const address = _page_position;
+  std::memcpy(address, value.data(), value.size());
+  _page_position += value.size();
+  _page_remaining_bytes -= value.size();
+  return address;
+}
+
+void StringVector::push_back(const std::string_view value) {
+  if (value.size() <= GermanString::INLINE_CAPACITY) {
+    _strings.emplace_back(value);
+    return;
+  }
+  _strings.emplace_back(std::string_view{_copy_to_arena(value), value.size()});
+}
+
+size_t StringVector::size() const {
+  return _strings.size();
+}
+
+bool StringVector::empty() const {
+  return _strings.empty();
+}
+
+void StringVector::reserve(const size_t value_count) {
+  _strings.reserve(value_count);
+}
+
+void StringVector::shrink_to_fit() {
+  _strings.shrink_to_fit();
+}
+
+StringVector::Iterator StringVector::begin() const {
+  return Iterator{this, 0};
+}
+
+StringVector::Iterator StringVector::end() const {
+  return Iterator{this, size()};
+}
+
+size_t StringVector::estimate_memory_usage() const {
+  return _strings.capacity() * sizeof(GermanString) + _pages.capacity() * sizeof(std::unique_ptr<char[]>) +
+         _arena_bytes;
+}
+
+}  // namespace opossum
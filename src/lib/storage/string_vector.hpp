@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "german_string.hpp"
+
+namespace opossum {
+
+// StringVector stores the values of a string segment as GermanStrings. Values that are too long to be inlined are
+// copied into an arena of pages instead of allocating each std::string on its own. Pages are never moved or freed
+// before the StringVector, so the GermanStrings can point into them, and appending only allocates when a page is full
+// or the vector of GermanStrings grows. Values are read as std::string_views, which stay valid until the next
+// push_back().
+class StringVector {
+ public:
+  // Random access iterator over the values as std::string_views.
+  class Iterator : public boost::iterator_facade<Iterator, std::string_view, boost::random_access_traversal_tag,
+                                                 std::string_view> {
+   public:
+    Iterator() = default;
+    Iterator(const StringVector* string_vector, const size_t index) : _string_vector{string_vector}, _index{index} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    std::string_view dereference() const {
+      return (*_string_vector)[_index];
+    }
+
+    bool equal(const Iterator& other) const {
+      return _index == other._index;
+    }
+
+    void increment() {
+      ++_index;
+    }
+
+    void decrement() {
+      --_index;
+    }
+
+    void advance(const std::ptrdiff_t distance) {
+      _index += distance;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    const StringVector* _string_vector{nullptr};
+    size_t _index{0};
+  };
+
+  StringVector() = default;
+
+  // Copies the given values into the arena.
+  explicit StringVector(const std::vector<std::string>& values);
+
+  // Copies rebuild the arena, as the GermanStrings of the copy have to point to its own pages.
+  StringVector(const StringVector& other);
+  StringVector& operator=(const StringVector& other);
+
+  // Moves take over the pages. The moved-from vector is left empty, without a current page, so that appending to it
+  // allocates a page of its own.
+  StringVector(StringVector&& other) noexcept;
+  StringVector& operator=(StringVector&& other) noexcept;
+
+  // Appends a value.
+  void push_back(const std::string_view value);
+
+  // Returns the value at a given position. The view points into the arena or the GermanString.
+  std::string_view operator[](const size_t index) const {
+    return _strings[index].view();
+  }
+
+  // Returns the GermanString at a given position, e.g., to compare values by their prefixes.
+  const GermanString& german_string(const size_t index) const {
+    return _strings[index];
+  }
+
+  // Returns the number of values.
+  size_t size() const;
+
+  // Returns whether there are no values.
+  bool empty() const;
+
+  // Reserves memory for the given number of values.
+  void reserve(const size_t value_count);
+
+  // Releases unused memory of the vector of GermanStrings. Pages of the arena are not shrunk, as that would move the
+  // values.
+  void shrink_to_fit();
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  // Returns the calculated memory usage, including the arena.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // The first page of the arena has MIN_PAGE_SIZE bytes, each further one twice the size of its predecessor, up to
+  // MAX_PAGE_SIZE. Values that do not fit into a page of MAX_PAGE_SIZE bytes get a page of their own.
+  static constexpr auto MIN_PAGE_SIZE = size_t{4096};
+  static constexpr auto MAX_PAGE_SIZE = size_t{1} << 20;
+
+  // Copies a long value into the arena and returns its address there.
+  const char* _copy_to_arena(const std::string_view value);
+
+  std::vector<GermanString> _strings;
+  std::vector<std::unique_ptr<char[]>> _pages;
+  char* _page_position{nullptr};
+  size_t _page_remaining_bytes{0};
+  size_t _arena_bytes{0};
+};
+
+}  // namespace opossum
@@ -1,48 +1,83 @@
 #include "table.hpp"
 
+#include <algorithm>
 #include <thread>
 
+#include "bloom_filter.hpp"
 #include "dictionary_segment.hpp"
+#include "encoding_advisor.hpp"
+#include "index/b_plus_tree_index.hpp"
+#include "index/cracking_index.hpp"
+#include "index/group_key_index.hpp"
+#include "index/imprint_index.hpp"
 #include "resolve_type.hpp"
+#include "sorted_segment_search.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
 Table::Table(const ChunkOffset target_chunk_size)
-    : _chunks{}, _column_names{}, _column_types{}, _column_nullable{}, _target_chunk_size(target_chunk_size) {
+    : _chunks{},
+      _column_names{},
+      _column_data_types{},
+      _column_nullable{},
+      _column_encodings{},
+      _column_bloom_filters{},
+      _column_index_types{},
+      _pending_dictionaries{},
+      _target_chunk_size(target_chunk_size) {
   create_new_chunk();
 }
 
-void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
+void Table::add_column_definition(const std::string& name, const DataType data_type, const bool nullable) {
   _column_names.emplace_back(name);
-  _column_types.emplace_back(type);
+  _column_data_types.emplace_back(data_type);
   _column_nullable.emplace_back(nullable);
+  _column_encodings.emplace_back();
+  _column_bloom_filters.emplace_back(false);
+  _column_index_types.emplace_back();
+  _pending_dictionaries.emplace_back();
 }
 
-void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
+void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
+  add_column_definition(name, data_type_from_string(type), nullable);
+}
+
+void Table::add_column(const std::string& name, const DataType data_type, const bool nullable) {
   Assert(row_count() == 0, "Table is not empty, can't add column.");
   for (const auto& chunk : _chunks) {
-    auto new_segment = std::shared_ptr<AbstractSegment>{};
-    resolve_data_type(type, [&](auto data_type) {
-      using DataType = typename decltype(data_type)::type;
-      new_segment = std::make_shared<ValueSegment<DataType>>(nullable);
+    resolve_data_type(data_type, [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(nullable),
+                         std::make_shared<ZoneMap<ColumnDataType>>());
     });
-    chunk->add_segment(new_segment);
   }
-  add_column_definition(name, type, nullable);
+  add_column_definition(name, data_type, nullable);
+}
+
+void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
+  add_column(name, data_type_from_string(type), nullable);
 }
 
 void Table::create_new_chunk() {
   auto new_chunk = std::make_shared<Chunk>();
-  for (auto index = uint16_t{0}; index < _column_names.size(); ++index) {
-    auto new_segment = std::shared_ptr<AbstractSegment>{};
-    resolve_data_type(_column_types[index], [&](auto data_type) {
-      using DataType = typename decltype(data_type)::type;
-      new_segment = std::make_shared<ValueSegment<DataType>>(_column_nullable[index]);
+  const auto column_count = _column_names.size();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    // The zone maps and B+-trees of the new chunk are maintained while rows are appended.
+    resolve_data_type(_column_data_types[column_id], [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto segment = std::make_shared<ValueSegment<ColumnDataType>>(_column_nullable[column_id]);
+      new_chunk->add_segment(segment, std::make_shared<ZoneMap<ColumnDataType>>());
+      if (_column_index_types[column_id] == IndexType::BPlusTree) {
+        new_chunk->set_index(column_id, _create_index(column_id, segment));
+      }
     });
-    new_chunk->add_segment(new_segment);
   }
+  new_chunk->set_individually_sorted_by(_sorted_by);
   _chunks.emplace_back(new_chunk);
   _last_chunk_encoded = false;
 }
@@ -85,13 +120,66 @@ const std::string& Table::column_name(const ColumnID column_id) const {
 }
 
 const std::string& Table::column_type(const ColumnID column_id) const {
-  return _column_types.at(column_id);
+  return data_type_to_string(column_data_type(column_id));
+}
+
+DataType Table::column_data_type(const ColumnID column_id) const {
+  return _column_data_types.at(column_id);
 }
 
 bool Table::column_nullable(const ColumnID column_id) const {
   return _column_nullable.at(column_id);
 }
 
+void Table::set_column_encoding(const ColumnID column_id, const SegmentEncodingSpec& spec) {
+  Assert(encoding_supports_data_type(spec.encoding_type, column_data_type(column_id)),
+         "Encoding does not support data type " + column_type(column_id) + ".");
+  Assert(!spec.use_shared_dictionary || spec.encoding_type == EncodingType::Dictionary,
+         "Only dictionary encoded columns can share a dictionary.");
+  _column_encodings[column_id] = spec;
+}
+
+const SegmentEncodingSpec& Table::column_encoding(const ColumnID column_id) const {
+  return _column_encodings.at(column_id);
+}
+
+void Table::set_column_bloom_filter(const ColumnID column_id, const bool use_bloom_filter) {
+  _column_bloom_filters.at(column_id) = use_bloom_filter;
+}
+
+bool Table::column_bloom_filter(const ColumnID column_id) const {
+  return _column_bloom_filters.at(column_id);
+}
+
+void Table::set_column_index_type(const ColumnID column_id, const std::optional<IndexType> index_type) {
+  _column_index_types.at(column_id) = index_type;
+
+  // Rows are still appended to the last chunk unless it was compressed, so its index is replaced right away. Only
+  // B+-trees can be maintained while rows are appended.
+  if (!_last_chunk_encoded) {
+    const auto& chunk = _chunks.back();
+    const auto maintained_on_append = index_type == IndexType::BPlusTree;
+    const auto segment = chunk->get_segment(column_id);
+    chunk->set_index(column_id, maintained_on_append ? _create_index(column_id, segment) : nullptr);
+  }
+}
+
+std::optional<IndexType> Table::column_index_type(const ColumnID column_id) const {
+  return _column_index_types.at(column_id);
+}
+
+void Table::set_sorted_by(const std::vector<SortColumnDefinition>& sorted_by) {
+  Assert(row_count() == 0, "Table is not empty, can't declare sort order.");
+  for (const auto& chunk : _chunks) {
+    chunk->set_individually_sorted_by(sorted_by);
+  }
+  _sorted_by = sorted_by;
+}
+
+const std::vector<SortColumnDefinition>& Table::sorted_by() const {
+  return _sorted_by;
+}
+
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
   return _chunks.at(chunk_id);
 }
@@ -100,27 +188,58 @@ std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   return _chunks.at(chunk_id);
 }
 
-void compress_segment(const std::shared_ptr<AbstractSegment> segment,
-                      std::vector<std::shared_ptr<AbstractSegment>>& compressed_segments, ColumnID segment_index,
-                      std::string type) {
-  resolve_data_type(type, [&](const auto data_type_t) {
+// The encoded segment and the metadata that compress_chunk derives from a segment.
+struct CompressedSegment {
+  std::shared_ptr<AbstractSegment> segment;
+  SegmentEncodingSpec spec;
+  std::shared_ptr<BaseZoneMap> zone_map;
+  std::shared_ptr<const BaseBloomFilter> bloom_filter;
+  std::shared_ptr<const BaseColumnStatistics> statistics;
+  std::optional<SortMode> sort_mode;
+};
+
+void compress_segment(const std::shared_ptr<AbstractSegment> segment, CompressedSegment& compressed_segment,
+                      DataType data_type, SegmentEncodingSpec spec, bool use_bloom_filter, bool generate_statistics,
+                      size_t max_thread_count) {
+  if (spec.encoding_type == EncodingType::Auto) {
+    spec = choose_segment_encoding(segment, data_type);
+  }
+  compressed_segment.segment = encode_segment(segment, data_type, spec, max_thread_count);
+  compressed_segment.spec = spec;
+
+  // The zone map is computed from scratch, as the segment may not have had one before (e.g., if it was added to the
+  // chunk directly).
+  resolve_data_type(data_type, [&](auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
-    auto compressed_segment = std::make_shared<DictionarySegment<ColumnDataType>>(segment);
-    compressed_segments[segment_index] = compressed_segment;
+    compressed_segment.zone_map = std::make_shared<ZoneMap<ColumnDataType>>(*segment);
+    compressed_segment.sort_mode = detect_sort_mode<ColumnDataType>(*segment);
+    if (use_bloom_filter) {
+      compressed_segment.bloom_filter = std::make_shared<BloomFilter<ColumnDataType>>(*segment);
+    }
+    if (generate_statistics) {
+      compressed_segment.statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(*segment);
+    }
   });
 }
 
-void Table::compress_chunk(const ChunkID chunk_id) {
+std::vector<SegmentEncodingSpec> Table::compress_chunk(const ChunkID chunk_id) {
   const auto old_chunk = get_chunk(chunk_id);
   const auto segment_count = old_chunk->column_count();
   auto new_chunk = std::make_shared<Chunk>();
-  auto compressed_segments = std::vector<std::shared_ptr<AbstractSegment>>(segment_count);
+  auto compressed_segments = std::vector<CompressedSegment>(segment_count);
 
+  // Each column is compressed by its own thread. The cores are divided among them, so that the encodings, which may
+  // start threads of their own, do not oversubscribe the machine on wide tables.
+  const auto core_count = size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+  const auto column_count = std::max(static_cast<size_t>(segment_count), size_t{1});
+  const auto max_thread_count = std::max(core_count / column_count, size_t{1});
   auto threads = std::vector<std::thread>();
   for (auto segment_index = ColumnID{0}; segment_index < segment_count; ++segment_index) {
-    const auto type = this->column_type(segment_index);
+    const auto data_type = column_data_type(segment_index);
     const auto old_segment = old_chunk->get_segment(segment_index);
-    auto worker = std::thread(compress_segment, old_segment, std::ref(compressed_segments), segment_index, type);
+    auto worker = std::thread(compress_segment, old_segment, std::ref(compressed_segments[segment_index]), data_type,
+                              _column_encodings[segment_index], _column_bloom_filters[segment_index],
+                              static_cast<bool>(_statistics), max_thread_count);
     threads.push_back(std::move(worker));
   }
   // threads join
@@ -128,14 +247,229 @@ void Table::compress_chunk(const ChunkID chunk_id) {
     thread.join();
   }
 
-  for (const auto& segment : compressed_segments) {
-    new_chunk->add_segment(segment);
+  for (auto segment_index = ColumnID{0}; segment_index < segment_count; ++segment_index) {
+    auto& compressed_segment = compressed_segments[segment_index];
+    if (compressed_segment.spec.encoding_type == EncodingType::Dictionary &&
+        compressed_segment.spec.use_shared_dictionary) {
+      compressed_segment.segment = _share_dictionary(segment_index, chunk_id, compressed_segment.segment);
+    }
+  }
+
+  auto chosen_encodings = std::vector<SegmentEncodingSpec>{};
+  auto sorted_by = std::vector<SortColumnDefinition>{};
+  auto chunk_statistics = TableStatistics::ChunkStatistics{};
+  for (auto segment_index = ColumnID{0}; segment_index < segment_count; ++segment_index) {
+    const auto& compressed_segment = compressed_segments[segment_index];
+    new_chunk->add_segment(compressed_segment.segment, compressed_segment.zone_map, compressed_segment.bloom_filter);
+    new_chunk->set_index(segment_index, _create_index(segment_index, compressed_segment.segment));
+    chosen_encodings.push_back(compressed_segment.spec);
+    if (compressed_segment.sort_mode) {
+      sorted_by.push_back({segment_index, *compressed_segment.sort_mode});
+    }
+    if (compressed_segment.statistics) {
+      chunk_statistics.push_back(compressed_segment.statistics);
+    }
   }
+  new_chunk->set_individually_sorted_by(sorted_by);
 
   _chunks[chunk_id] = new_chunk;
   if (chunk_id == chunk_count() - 1) {
     _last_chunk_encoded = true;
   }
+
+  // Pending dictionaries are merged one column at a time, as this replaces the chunks of the column, including the
+  // compressed one.
+  for (auto segment_index = ColumnID{0}; segment_index < segment_count; ++segment_index) {
+    const auto& pending_dictionaries = _pending_dictionaries[segment_index];
+    if (static_cast<double>(pending_dictionaries.value_count) >
+        static_cast<double>(pending_dictionaries.shared_dictionary_size) * MAX_PENDING_DICTIONARY_SHARE) {
+      _merge_pending_dictionaries(segment_index);
+    }
+  }
+
+  // The statistics of the other chunks are reused. Chunks created after the statistics do not have any yet.
+  if (_statistics) {
+    auto all_chunk_statistics = _statistics->chunk_statistics();
+    all_chunk_statistics.resize(chunk_count());
+    all_chunk_statistics[chunk_id] = std::move(chunk_statistics);
+    _statistics = std::make_shared<TableStatistics>(_column_data_types, std::move(all_chunk_statistics));
+  }
+  return chosen_encodings;
+}
+
+void Table::generate_statistics() {
+  _statistics = std::make_shared<TableStatistics>(*this);
+}
+
+std::shared_ptr<const TableStatistics> Table::statistics() const {
+  return _statistics;
+}
+
+void Table::share_dictionaries() {
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    if (!_pending_dictionaries[column_id].chunk_ids.empty()) {
+      _merge_pending_dictionaries(column_id);
+    }
+  }
+}
+
+std::shared_ptr<AbstractSegment> Table::_share_dictionary(const ColumnID column_id, const ChunkID chunk_id,
+                                                          const std::shared_ptr<AbstractSegment>& segment) {
+  auto shared_segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    using Segment = DictionarySegment<ColumnDataType>;
+    const auto& dictionary_segment = static_cast<const Segment&>(*segment);
+
+    // All segments that share a dictionary reference the same one, so the first of them is sufficient.
+    auto column_segment = std::shared_ptr<const Segment>{};
+    for (const auto& chunk : _chunks) {
+      const auto other_segment = std::dynamic_pointer_cast<const Segment>(chunk->get_segment(column_id));
+      if (other_segment && other_segment->has_shared_dictionary()) {
+        column_segment = other_segment;
+        break;
+      }
+    }
+
+    // The first compressed chunk of the column contributes the initial dictionary.
+    if (!column_segment) {
+      shared_segment = std::make_shared<Segment>(dictionary_segment, dictionary_segment.shared_dictionary());
+      return;
+    }
+
+    const auto& column_dictionary = column_segment->shared_dictionary();
+    const auto merged_dictionary = Segment::merge_dictionaries(column_dictionary, dictionary_segment.dictionary());
+    if (merged_dictionary == column_dictionary) {
+      shared_segment = std::make_shared<Segment>(dictionary_segment, column_dictionary, column_segment->search_index());
+      return;
+    }
+
+    // Extending the shared dictionary right away would re-encode all other chunks of the column for every chunk with
+    // a new value. Instead, the segment keeps its own dictionary until compress_chunk merges the pending ones.
+    shared_segment = segment;
+    auto& pending_dictionaries = _pending_dictionaries[column_id];
+    if (std::find(pending_dictionaries.chunk_ids.begin(), pending_dictionaries.chunk_ids.end(), chunk_id) ==
+        pending_dictionaries.chunk_ids.end()) {
+      pending_dictionaries.chunk_ids.push_back(chunk_id);
+    }
+    pending_dictionaries.value_count += merged_dictionary->size() - column_dictionary->size();
+    pending_dictionaries.shared_dictionary_size = column_dictionary->size();
+  });
+  return shared_segment;
+}
+
+void Table::_merge_pending_dictionaries(const ColumnID column_id) {
+  auto& pending_dictionaries = _pending_dictionaries[column_id];
+  resolve_data_type(column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    using Segment = DictionarySegment<ColumnDataType>;
+
+    // A pending chunk may have been compressed again since, e.g., with another encoding, so its segment is checked.
+    const auto pending_segment = [&](const ChunkID chunk_id) {
+      const auto segment = std::dynamic_pointer_cast<const Segment>(_chunks[chunk_id]->get_segment(column_id));
+      const auto& chunk_ids = pending_dictionaries.chunk_ids;
+      const auto is_pending = std::find(chunk_ids.begin(), chunk_ids.end(), chunk_id) != chunk_ids.end();
+      return is_pending && segment && !segment->has_shared_dictionary() ? segment : nullptr;
+    };
+
+    auto column_dictionary = std::shared_ptr<const typename Segment::DictionaryType>{};
+    for (const auto& chunk : _chunks) {
+      const auto segment = std::dynamic_pointer_cast<const Segment>(chunk->get_segment(column_id));
+      if (segment && segment->has_shared_dictionary()) {
+        column_dictionary = segment->shared_dictionary();
+        break;
+      }
+    }
+    if (!column_dictionary) {
+      return;
+    }
+
+    auto merged_dictionary = column_dictionary;
+    for (const auto chunk_id : pending_dictionaries.chunk_ids) {
+      if (const auto segment = pending_segment(chunk_id)) {
+        merged_dictionary = Segment::merge_dictionaries(merged_dictionary, segment->dictionary());
+      }
+    }
+
+    // Like the compressed chunk itself, the chunks with re-encoded segments are replaced as a whole, so that readers
+    // holding the previous chunk still see consistent segments. Re-encoding does not change the values of a segment, so
+    // its zone map and Bloom filter are kept, and so are B+-trees and cracker columns. GroupKey and imprint indexes
+    // read the value ids or the lines of the old segment, though, and are built again.
+    auto search_index = std::shared_ptr<const DictionarySearchIndex<ColumnDataType>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+      auto& chunk = _chunks[chunk_id];
+      auto other_segment = pending_segment(chunk_id);
+      if (!other_segment) {
+        other_segment = std::dynamic_pointer_cast<const Segment>(chunk->get_segment(column_id));
+        if (!other_segment || other_segment->shared_dictionary() != column_dictionary ||
+            merged_dictionary == column_dictionary) {
+          continue;
+        }
+      }
+
+      // The first re-encoded segment builds the search index of the merged dictionary, all others share it.
+      const auto reencoded_segment = std::make_shared<Segment>(*other_segment, merged_dictionary, search_index);
+      search_index = reencoded_segment->search_index();
+
+      auto new_chunk = std::make_shared<Chunk>();
+      const auto column_count = chunk->column_count();
+      for (auto other_column_id = ColumnID{0}; other_column_id < column_count; ++other_column_id) {
+        const auto zone_map = chunk->get_zone_map(other_column_id);
+        const auto bloom_filter = chunk->get_bloom_filter(other_column_id);
+        if (other_column_id == column_id) {
+          new_chunk->add_segment(reencoded_segment, zone_map, bloom_filter);
+          const auto index_type = _column_index_types[column_id];
+          const auto reads_segment = index_type == IndexType::GroupKey || index_type == IndexType::Imprint;
+          new_chunk->set_index(other_column_id, reads_segment ? _create_index(column_id, reencoded_segment)
+                                                              : chunk->get_index(other_column_id));
+        } else {
+          new_chunk->add_segment(chunk->get_segment(other_column_id), zone_map, bloom_filter);
+          new_chunk->set_index(other_column_id, chunk->get_index(other_column_id));
+        }
+      }
+      new_chunk->set_individually_sorted_by(chunk->individually_sorted_by());
+      chunk = new_chunk;
+    }
+  });
+  pending_dictionaries = PendingDictionaries{};
+}
+
+std::shared_ptr<BaseIndex> Table::_create_index(const ColumnID column_id,
+                                                const std::shared_ptr<AbstractSegment>& segment) const {
+  const auto index_type = _column_index_types[column_id];
+  if (!index_type) {
+    return nullptr;
+  }
+
+  auto index = std::shared_ptr<BaseIndex>{};
+  resolve_data_type(column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    switch (*index_type) {
+      case IndexType::GroupKey: {
+        const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment);
+        if (dictionary_segment) {
+          index = std::make_shared<GroupKeyIndex<ColumnDataType>>(dictionary_segment);
+        }
+        return;
+      }
+      case IndexType::BPlusTree:
+        index = std::make_shared<BPlusTreeIndex<ColumnDataType>>(*segment);
+        return;
+      case IndexType::Cracking:
+        index = std::make_shared<CrackingIndex<ColumnDataType>>(segment);
+        return;
+      case IndexType::Imprint:
+        if constexpr (!std::is_same_v<ColumnDataType, std::string>) {
+          if (std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment) ||
+              std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+            index = std::make_shared<ImprintIndex<ColumnDataType>>(segment);
+          }
+        }
+        return;
+    }
+    Fail("Unknown index type.");
+  });
+  return index;
 }
 
 }  // namespace opossum
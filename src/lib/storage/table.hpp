@@ -2,6 +2,8 @@
 
 #include "abstract_segment.hpp"
 #include "chunk.hpp"
+#include "index/base_index.hpp"
+#include "segment_encoding.hpp"
 #include "type_cast.hpp"
 
 namespace opossum {
@@ -35,9 +37,12 @@ class Table : private Noncopyable {
   // Returns the column name of the nth column.
   const std::string& column_name(const ColumnID column_id) const;
 
-  // Returns the column type of the nth column.
+  // Returns the type string (e.g., "int") of the nth column.
   const std::string& column_type(const ColumnID column_id) const;
 
+  // Returns the data type of the nth column.
+  DataType column_data_type(const ColumnID column_id) const;
+
   // Returns whether the nth column can contain NULL values.
   bool column_nullable(const ColumnID column_id) const;
 
@@ -49,11 +54,13 @@ class Table : private Noncopyable {
   ChunkOffset target_chunk_size() const;
 
   // Adds column definition without creating the actual columns. This is helpful when, e.g., an operator first creates
-  // the structure of the table and then adds chunk by chunk.
+  // the structure of the table and then adds chunk by chunk. The type can also be given as a type string (e.g., "int").
+  void add_column_definition(const std::string& name, const DataType data_type, const bool nullable);
   void add_column_definition(const std::string& name, const std::string& type, const bool nullable);
 
   // Adds a column to the end, i.e., right, of the table. This can only be done if the table does not yet have any
-  // entries, because we would otherwise have to deal with default values.
+  // entries, because we would otherwise have to deal with default values. The type can also be given as a type string.
+  void add_column(const std::string& name, const DataType data_type, const bool nullable);
   void add_column(const std::string& name, const std::string& type, const bool nullable);
 
   // Inserts a row at the end of the table. Note this is slow and not thread-safe and should be used for testing
@@ -63,14 +70,98 @@ class Table : private Noncopyable {
   // Creates a new chunk and appends it.
   void create_new_chunk();
 
-  // Compresses a ValueColumn into a DictionaryColumn.
-  void compress_chunk(const ChunkID chunk_id);
+  // Sets how the segments of a column are encoded by compress_chunk. By default, columns are dictionary encoded.
+  void set_column_encoding(const ColumnID column_id, const SegmentEncodingSpec& spec);
+
+  // Returns the encoding spec of the nth column. This may be EncodingType::Auto.
+  const SegmentEncodingSpec& column_encoding(const ColumnID column_id) const;
+
+  // Sets whether compress_chunk builds a Bloom filter for the segments of a column (see BloomFilter). This pays off for
+  // columns that are searched for single values, but whose values are spread over all chunks, e.g., keys. By default,
+  // no Bloom filters are built.
+  void set_column_bloom_filter(const ColumnID column_id, const bool use_bloom_filter);
+
+  // Returns whether compress_chunk builds a Bloom filter for the segments of the nth column.
+  bool column_bloom_filter(const ColumnID column_id) const;
+
+  // Encodes the ValueSegments of a chunk according to the column encodings. Returns the encoding chosen for each
+  // segment, which differs from the column encoding if that is EncodingType::Auto. The compressed chunk is marked as
+  // sorted by all columns whose values are in order, whether or not this was declared. Segments with values that the
+  // shared dictionary of their column lacks keep a pending dictionary of their own (see MAX_PENDING_DICTIONARY_SHARE).
+  std::vector<SegmentEncodingSpec> compress_chunk(const ChunkID chunk_id);
+
+  // Sets which index is built for the segments of a column, or std::nullopt for none, which is the default. A GroupKey
+  // index is built by compress_chunk and only for DictionarySegments, so other segments of the column (e.g., if the
+  // encoding advisor chose another encoding) are not indexed. A B+-tree is also attached to the ValueSegments of new
+  // chunks and of the last chunk if it has not been compressed yet, and it is maintained while rows are appended. A
+  // cracking index is built by compress_chunk for segments of any encoding and only reads the segment once queried.
+  // Imprint indexes are built by compress_chunk for the ValueSegments and DictionarySegments of all columns whose
+  // type is not string.
+  void set_column_index_type(const ColumnID column_id, const std::optional<IndexType> index_type);
+
+  // Returns which index is built for the segments of the nth column.
+  std::optional<IndexType> column_index_type(const ColumnID column_id) const;
+
+  // Declares that rows are appended in the order of each of the given columns, e.g., because they are loaded in the
+  // order of a timestamp. Each chunk is then considered to be sorted by these columns, as long as the appended rows
+  // keep the order (see Chunk::append). This can only be done if the table does not yet have any entries.
+  void set_sorted_by(const std::vector<SortColumnDefinition>& sorted_by);
+
+  // Returns the columns by which rows are declared to be appended in order.
+  const std::vector<SortColumnDefinition>& sorted_by() const;
+
+  // Generates the statistics of the table. From then on, compress_chunk refreshes the statistics of each chunk that it
+  // compresses. Rows that are appended afterwards are only reflected once their chunk is compressed.
+  void generate_statistics();
+
+  // Returns the statistics of the table, or nullptr if they were not generated. The statistics are replaced, not
+  // modified, when a chunk is compressed.
+  std::shared_ptr<const TableStatistics> statistics() const;
+
+  // Merges the pending dictionaries of all columns into their shared dictionaries right away (see compress_chunk), so
+  // that all DictionarySegments of these columns share one dictionary again.
+  void share_dictionaries();
+
+  // compress_chunk merges the pending dictionaries of a column once the values they add to the shared dictionary
+  // amount to this share of its size. Each merge re-encodes all chunks of the column, so the dictionary has to grow
+  // by a constant factor in between for the cost to stay linear in the number of rows.
+  static constexpr auto MAX_PENDING_DICTIONARY_SHARE = 0.25;
 
  protected:
+  // The chunks of a column whose DictionarySegments still have a dictionary of their own, because it holds values
+  // that the shared dictionary lacks, and the number of these values (counted once per chunk).
+  struct PendingDictionaries {
+    std::vector<ChunkID> chunk_ids;
+    size_t value_count{0};
+    size_t shared_dictionary_size{0};
+  };
+
+  // Re-encodes the DictionarySegment of a column in a chunk that is being compressed against the dictionary shared by
+  // the column if the dictionary contains all values of the segment. Otherwise, the segment keeps its own dictionary
+  // and the chunk is added to the pending dictionaries of the column. The first segment of a column contributes the
+  // initial shared dictionary.
+  std::shared_ptr<AbstractSegment> _share_dictionary(const ColumnID column_id, const ChunkID chunk_id,
+                                                     const std::shared_ptr<AbstractSegment>& segment);
+
+  // Extends the shared dictionary of a column by the values of its pending dictionaries and re-encodes the segments of
+  // all chunks that share it or are pending.
+  void _merge_pending_dictionaries(const ColumnID column_id);
+
+  // Returns an index of the column's index type for a segment of the column, or nullptr if the column is
+  // not indexed or the segment cannot be indexed.
+  std::shared_ptr<BaseIndex> _create_index(const ColumnID column_id,
+                                           const std::shared_ptr<AbstractSegment>& segment) const;
+
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<std::string> _column_names;
-  std::vector<std::string> _column_types;
+  std::vector<DataType> _column_data_types;
   std::vector<bool> _column_nullable;
+  std::vector<SegmentEncodingSpec> _column_encodings;
+  std::vector<bool> _column_bloom_filters;
+  std::vector<std::optional<IndexType>> _column_index_types;
+  std::vector<PendingDictionaries> _pending_dictionaries;
+  std::vector<SortColumnDefinition> _sorted_by;
+  std::shared_ptr<const TableStatistics> _statistics;
   ChunkOffset _target_chunk_size;
   bool _last_chunk_encoded = false;
 };
@@ -0,0 +1,167 @@
+#include "validity_bitmap.hpp"
+
+namespace opossum {
+
+ValidityBitmap::ValidityBitmap(const size_t size, const bool valid)
+    : _words((size + BITS_PER_WORD - 1) / BITS_PER_WORD, valid ? ~uint64_t{0} : uint64_t{0}),
+      _size{size},
+      _null_count{valid ? 0 : size} {
+  // Clear the bits beyond the last row.
+  if (valid && size % BITS_PER_WORD != 0) {
+    _words.back() = (uint64_t{1} << (size % BITS_PER_WORD)) - 1;
+  }
+}
+
+void ValidityBitmap::set_valid(const size_t index, const bool valid) {
+  Assert(index < _size, "Index " + std::to_string(index) + " is out of range for ValidityBitmap.");
+  if (is_valid(index) == valid) {
+    return;
+  }
+
+  _words[index / BITS_PER_WORD] ^= uint64_t{1} << (index % BITS_PER_WORD);
+  if (valid) {
+    --_null_count;
+  } else {
+    ++_null_count;
+  }
+}
+
+void ValidityBitmap::push_back(const bool valid) {
+  if (_size % BITS_PER_WORD == 0) {
+    _words.push_back(0);
+  }
+
+  if (valid) {
+    _words.back() |= uint64_t{1} << (_size % BITS_PER_WORD);
+  } else {
+    ++_null_count;
+  }
+  ++_size;
+}
+
+void ValidityBitmap::reserve(const size_t size) {
+  _words.reserve((size + BITS_PER_WORD - 1) / BITS_PER_WORD);
+}
+
+void ValidityBitmap::assign(const size_t size, const bool valid) {
+  _words.assign((size + BITS_PER_WORD - 1) / BITS_PER_WORD, valid ? ~uint64_t{0} : uint64_t{0});
+  _size = size;
+  _null_count = valid ? 0 : size;
+  if (valid && size % BITS_PER_WORD != 0) {
+    _words.back() = (uint64_t{1} << (size % BITS_PER_WORD)) - 1;
+  }
+}
+
+void ValidityBitmap::assign(const ValidityBitmap& other, const size_t begin, const size_t end) {
+  Assert(begin <= end && end <= other._size, "Invalid range for ValidityBitmap::assign.");
+  Assert(&other != this, "A ValidityBitmap cannot be assigned a range of itself.");
+  _size = end - begin;
+  _words.resize((_size + BITS_PER_WORD - 1) / BITS_PER_WORD);
+
+  // Each word of the result combines the upper bits of one word of the other bitmap with the lower bits of the next.
+  const auto first_word = begin / BITS_PER_WORD;
+  const auto shift = begin % BITS_PER_WORD;
+  for (auto word_index = size_t{0}; word_index < _words.size(); ++word_index) {
+    auto word = other._words[first_word + word_index] >> shift;
+    if (shift != 0 && first_word + word_index + 1 < other._words.size()) {
+      word |= other._words[first_word + word_index + 1] << (BITS_PER_WORD - shift);
+    }
+    _words[word_index] = word;
+  }
+  if (_size % BITS_PER_WORD != 0) {
+    _words.back() &= (uint64_t{1} << (_size % BITS_PER_WORD)) - 1;
+  }
+  _update_null_count();
+}
+
+size_t ValidityBitmap::size() const {
+  return _size;
+}
+
+bool ValidityBitmap::empty() const {
+  return _size == 0;
+}
+
+size_t ValidityBitmap::null_count() const {
+  return _null_count;
+}
+
+size_t ValidityBitmap::valid_count() const {
+  return _size - _null_count;
+}
+
+bool ValidityBitmap::all_valid() const {
+  return _null_count == 0;
+}
+
+size_t ValidityBitmap::count_valid(const size_t begin, const size_t end) const {
+  Assert(begin <= end && end <= _size, "Invalid range for ValidityBitmap::count_valid.");
+  if (begin == end) {
+    return 0;
+  }
+
+  const auto first_word = begin / BITS_PER_WORD;
+  const auto last_word = (end - 1) / BITS_PER_WORD;
+  // Masks that keep the bits of the first and the last word that are within the range.
+  const auto first_mask = ~uint64_t{0} << (begin % BITS_PER_WORD);
+  const auto last_mask = ~uint64_t{0} >> (BITS_PER_WORD - 1 - (end - 1) % BITS_PER_WORD);
+  if (first_word == last_word) {
+    return std::popcount(_words[first_word] & first_mask & last_mask);
+  }
+
+  auto count = static_cast<size_t>(std::popcount(_words[first_word] & first_mask));
+  for (auto word_index = first_word + 1; word_index < last_word; ++word_index) {
+    count += std::popcount(_words[word_index]);
+  }
+  return count + std::popcount(_words[last_word] & last_mask);
+}
+
+const std::vector<uint64_t>& ValidityBitmap::words() const {
+  return _words;
+}
+
+ValidityBitmap& ValidityBitmap::operator&=(const ValidityBitmap& other) {
+  Assert(_size == other._size, "Only ValidityBitmaps of the same size can be combined.");
+  for (auto word_index = size_t{0}; word_index < _words.size(); ++word_index) {
+    _words[word_index] &= other._words[word_index];
+  }
+  _update_null_count();
+  return *this;
+}
+
+ValidityBitmap& ValidityBitmap::operator|=(const ValidityBitmap& other) {
+  Assert(_size == other._size, "Only ValidityBitmaps of the same size can be combined.");
+  for (auto word_index = size_t{0}; word_index < _words.size(); ++word_index) {
+    _words[word_index] |= other._words[word_index];
+  }
+  _update_null_count();
+  return *this;
+}
+
+void ValidityBitmap::_update_null_count() {
+  auto valid_count = size_t{0};
+  for (const auto word : _words) {
+    valid_count += std::popcount(word);
+  }
+  _null_count = _size - valid_count;
+}
+
+size_t ValidityBitmap::estimate_memory_usage() const {
+  return _words.size() * sizeof(uint64_t);
+}
+
+bool operator==(const ValidityBitmap& lhs, const ValidityBitmap& rhs) {
+  return lhs._size == rhs._size && lhs._words == rhs._words;
+}
+
+ValidityBitmap operator&(ValidityBitmap lhs, const ValidityBitmap& rhs) {
+  lhs &= rhs;
+  return lhs;
+}
+
+ValidityBitmap operator|(ValidityBitmap lhs, const ValidityBitmap& rhs) {
+  lhs |= rhs;
+  return lhs;
+}
+
+}  // namespace opossum
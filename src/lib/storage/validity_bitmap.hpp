@@ -0,0 +1,115 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// ValidityBitmap tracks which rows of a segment are NULL. Each row is represented by one bit in a vector of 64-bit
+// words, which is set if the row holds a value (i.e., is valid) and cleared if it is NULL. Bits beyond size() are
+// always cleared, so that whole words can be counted and combined. Operators that process many rows should work on
+// words(): a single word tells for 64 rows whether any of them is NULL, and all_valid() allows to skip NULL handling
+// entirely. The number of NULLs is maintained on every modification, so all_valid() and null_count() are O(1).
+class ValidityBitmap {
+ public:
+  static constexpr auto BITS_PER_WORD = size_t{64};
+
+  ValidityBitmap() = default;
+
+  // Creates a bitmap of the given size in which all rows are valid or all rows are NULL.
+  explicit ValidityBitmap(const size_t size, const bool valid = true);
+
+  // Returns whether a row holds a value.
+  bool is_valid(const size_t index) const {
+    DebugAssert(index < _size, "Index " + std::to_string(index) + " is out of range for ValidityBitmap.");
+    return (_words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+  }
+
+  // Returns whether a row is NULL.
+  bool is_null(const size_t index) const {
+    return !is_valid(index);
+  }
+
+  // Marks a row as valid or NULL.
+  void set_valid(const size_t index, const bool valid);
+
+  // Adds a row at the end.
+  void push_back(const bool valid);
+
+  // Reserves memory for the given number of rows.
+  void reserve(const size_t size);
+
+  // Replaces the rows with the given number of rows that are all valid or all NULL. Like the following overload, this
+  // reuses the allocated words, so that a bitmap can be refilled for every batch of rows.
+  void assign(const size_t size, const bool valid);
+
+  // Replaces the rows with the rows [begin, end) of another bitmap. Whole words are shifted into place.
+  void assign(const ValidityBitmap& other, const size_t begin, const size_t end);
+
+  // Returns the number of rows.
+  size_t size() const;
+
+  // Returns whether the bitmap has no rows.
+  bool empty() const;
+
+  // Returns the number of NULL rows.
+  size_t null_count() const;
+
+  // Returns the number of valid rows.
+  size_t valid_count() const;
+
+  // Returns whether no row is NULL.
+  bool all_valid() const;
+
+  // Returns the number of valid rows in [begin, end). Whole words are counted with a single popcount each.
+  size_t count_valid(const size_t begin, const size_t end) const;
+
+  // Calls the functor with the index of each valid row in [begin, end), in ascending order. Only the set bits of each
+  // word are visited, so words in which all rows are NULL are skipped at once.
+  template <typename Functor>
+  void for_each_valid(const size_t begin, const size_t end, const Functor& functor) const {
+    DebugAssert(begin <= end && end <= _size, "Invalid range for ValidityBitmap::for_each_valid.");
+    for (auto word_begin = begin - begin % BITS_PER_WORD; word_begin < end; word_begin += BITS_PER_WORD) {
+      auto word = _words[word_begin / BITS_PER_WORD];
+      if (word_begin < begin) {
+        word &= ~uint64_t{0} << (begin - word_begin);
+      }
+      if (end - word_begin < BITS_PER_WORD) {
+        word &= (uint64_t{1} << (end - word_begin)) - 1;
+      }
+      while (word != 0) {
+        functor(word_begin + std::countr_zero(word));
+        word &= word - 1;
+      }
+    }
+  }
+
+  // Returns the underlying words. Row i is stored in bit i % 64 of word i / 64.
+  const std::vector<uint64_t>& words() const;
+
+  // Combines two bitmaps of equal size word by word. A row of the result of AND is valid if it is valid in both
+  // bitmaps (e.g., for comparisons of two columns), one of OR if it is valid in any (e.g., for COALESCE).
+  ValidityBitmap& operator&=(const ValidityBitmap& other);
+  ValidityBitmap& operator|=(const ValidityBitmap& other);
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+  friend bool operator==(const ValidityBitmap& lhs, const ValidityBitmap& rhs);
+
+ protected:
+  // Recounts the NULLs after the words were modified in bulk.
+  void _update_null_count();
+
+  std::vector<uint64_t> _words;
+  size_t _size{0};
+  size_t _null_count{0};
+};
+
+ValidityBitmap operator&(ValidityBitmap lhs, const ValidityBitmap& rhs);
+ValidityBitmap operator|(ValidityBitmap lhs, const ValidityBitmap& rhs);
+
+}  // namespace opossum
@@ -1,12 +1,24 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
+
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 template <typename T>
-ValueSegment<T>::ValueSegment(bool nullable) : _values{}, _is_null_values{}, _segment_is_nullable(nullable) {}
+ValueSegment<T>::ValueSegment(bool nullable) : _values{}, _validity{}, _segment_is_nullable(nullable) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values)
+    : _values{}, _validity{}, _segment_is_nullable(false) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    _values = StringVector{values};
+  } else {
+    _values = std::move(values);
+  }
+}
 
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
@@ -18,13 +30,14 @@ AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const
 
 template <typename T>
 bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
-  return is_nullable() && _is_null_values.at(chunk_offset);
+  DebugAssert(chunk_offset < _values.size(), "Chunk offset " + std::to_string(chunk_offset) + " is out of range.");
+  return _segment_is_nullable && _validity.is_null(chunk_offset);
 }
 
 template <typename T>
 T ValueSegment<T>::get(const ChunkOffset chunk_offset) const {
   Assert(!is_null(chunk_offset), "Chunk is null, can't return value.");
-  return _values[chunk_offset];
+  return T{_values[chunk_offset]};
 }
 
 template <typename T>
@@ -39,15 +52,18 @@ template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& value) {
   if (variant_is_null(value)) {
     Assert(_segment_is_nullable, "Tried to insert NULL value in not nullable segment!");
-    _values.push_back(type_cast<T>(0));
-    _is_null_values.push_back(true);
+    _values.push_back(T{});
+    _validity.push_back(false);
   } else {
     try {
       _values.push_back(type_cast<T>(value));
-      _is_null_values.push_back(false);
     } catch (...) {
       throw std::logic_error{"Wrong argument type"};
     }
+    // Non-nullable segments do not maintain a bitmap at all.
+    if (_segment_is_nullable) {
+      _validity.push_back(true);
+    }
   }
 }
 
@@ -57,24 +73,49 @@ ChunkOffset ValueSegment<T>::size() const {
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+const typename ValueSegment<T>::ValueVector& ValueSegment<T>::values() const {
   return _values;
 }
 
+template <typename T>
+void ValueSegment<T>::materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out,
+                                        ValidityBitmap* nulls) const {
+  Assert(begin <= end && end <= size(), "Invalid range for ValueSegment::materialize_range.");
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      out[chunk_offset - begin] = _values[chunk_offset];
+    }
+  } else {
+    std::copy(_values.begin() + begin, _values.begin() + end, out);
+  }
+
+  if (nulls) {
+    if (_segment_is_nullable) {
+      nulls->assign(_validity, begin, end);
+    } else {
+      nulls->assign(end - begin, true);
+    }
+  }
+}
+
 template <typename T>
 bool ValueSegment<T>::is_nullable() const {
   return _segment_is_nullable;
 }
 
 template <typename T>
-const std::vector<bool>& ValueSegment<T>::null_values() const {
+const ValidityBitmap& ValueSegment<T>::null_values() const {
   Assert(is_nullable(), "Segment is not nullable, so can't retrieve null values.");
-  return _is_null_values;
+  return _validity;
 }
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  return _values.capacity() * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _values.estimate_memory_usage();
+  } else {
+    return _values.capacity() * sizeof(T);
+  }
 }
 
 // Macro to instantiate the following classes:
@@ -1,15 +1,23 @@
 #pragma once
 
-#include "abstract_segment.hpp"
+#include "base_value_segment.hpp"
+#include "string_vector.hpp"
+#include "validity_bitmap.hpp"
 
 namespace opossum {
 
-// ValueSegment is a segment type that stores all its values in a vector.
+// ValueSegment is a segment type that stores all its values in a vector. Strings are stored in a StringVector, which
+// keeps their bytes in a single arena instead of allocating each of them separately.
 template <typename T>
-class ValueSegment : public AbstractSegment {
+class ValueSegment : public BaseValueSegment {
  public:
+  using ValueVector = std::conditional_t<std::is_same_v<T, std::string>, StringVector, std::vector<T>>;
+
   explicit ValueSegment(bool nullable = false);
 
+  // Creates a non-nullable segment that takes ownership of the given values.
+  explicit ValueSegment(std::vector<T>&& values);
+
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
@@ -23,30 +31,35 @@ class ValueSegment : public AbstractSegment {
   std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
 
   // Adds a value at the end of the segment.
-  void append(const AllTypeVariant& value);
+  void append(const AllTypeVariant& value) final;
 
   // Returns the number of entries.
   ChunkOffset size() const final;
 
   // Returns all values. This is the preferred method to check a value at a certain index. Usually you need to access
-  // more than a single value anyway.
+  // more than a single value anyway. Strings are returned as std::string_views into the segment.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const ValueVector& values() const;
+
+  // Copies the values of the rows [begin, end) to out, which has to hold end - begin entries. If nulls is given, it is
+  // refilled with the validity of these rows. Strings are copied into std::strings.
+  void materialize_range(const ChunkOffset begin, const ChunkOffset end, T* out, ValidityBitmap* nulls) const;
 
   // Returns whether segment supports NULL values.
   bool is_nullable() const;
 
-  // Returns NULL value vector that indicates whether a value is NULL with true at position i. Throw an exception if
-  // is_nullable() returns false. This is the preferred method to check for a NULL value at a certain index. Usually
-  // you need to access more than a single value anyway.
-  const std::vector<bool>& null_values() const;
+  // Returns the validity bitmap that indicates whether a value is NULL with a cleared bit at position i. Throw an
+  // exception if is_nullable() returns false. This is the preferred method to check for NULL values. Usually you need
+  // to access more than a single value anyway, and the bitmap allows to check 64 values at once.
+  const ValidityBitmap& null_values() const;
 
   // Returns the calculated memory usage.
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _values;
-  std::vector<bool> _is_null_values;
+  ValueVector _values;
+  // Only maintained for nullable segments.
+  ValidityBitmap _validity;
   bool _segment_is_nullable;
 };
 
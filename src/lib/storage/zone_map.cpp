@@ -0,0 +1,97 @@
+#include "zone_map.hpp"
+
+#include <cmath>
+
+#include "segment_iterate.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const AbstractSegment& segment) {
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null) {
+      ++_null_count;
+    } else {
+      _add_value(position.value);
+    }
+  });
+}
+
+template <typename T>
+void ZoneMap<T>::append(const AllTypeVariant& value) {
+  if (variant_is_null(value)) {
+    ++_null_count;
+  } else {
+    _add_value(type_cast<T>(value));
+  }
+}
+
+template <typename T>
+bool ZoneMap<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto* typed_search_value = boost::get<T>(&search_value);
+  if (!typed_search_value) {
+    return false;
+  }
+  if (_contains_nan && scan_type == ScanType::OpNotEquals) {
+    return false;
+  }
+  if (!_min) {
+    return true;
+  }
+
+  const auto& value = *typed_search_value;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return value < *_min || *_max < value;
+    case ScanType::OpNotEquals:
+      return *_min == value && *_max == value;
+    case ScanType::OpLessThan:
+      return !(*_min < value);
+    case ScanType::OpLessThanEquals:
+      return value < *_min;
+    case ScanType::OpGreaterThan:
+      return !(value < *_max);
+    case ScanType::OpGreaterThanEquals:
+      return *_max < value;
+  }
+  Fail("Unknown scan type.");
+}
+
+template <typename T>
+AllTypeVariant ZoneMap<T>::min() const {
+  return _min ? AllTypeVariant{*_min} : NULL_VALUE;
+}
+
+template <typename T>
+AllTypeVariant ZoneMap<T>::max() const {
+  return _max ? AllTypeVariant{*_max} : NULL_VALUE;
+}
+
+template <typename T>
+ChunkOffset ZoneMap<T>::null_count() const {
+  return _null_count;
+}
+
+template <typename T>
+template <typename Value>
+void ZoneMap<T>::_add_value(const Value& value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(value)) {
+      _contains_nan = true;
+      return;
+    }
+  }
+
+  // Strings are passed as string_views by segment_iterate and only copied if they extend the range.
+  if (!_min || value < *_min) {
+    _min = T{value};
+  }
+  if (!_max || *_max < value) {
+    _max = T{value};
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
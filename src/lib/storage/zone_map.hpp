@@ -0,0 +1,76 @@
+#pragma once
+
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// BaseZoneMap is the base class of all ZoneMaps. It allows chunks to maintain and query the zone maps of their segments
+// without resolving the data type first.
+class BaseZoneMap : private Noncopyable {
+ public:
+  virtual ~BaseZoneMap() = default;
+
+  // Includes a value that was appended to the segment. NULL values only increase the null count.
+  virtual void append(const AllTypeVariant& value) = 0;
+
+  // Returns whether no row of the segment can satisfy `value <scan_type> search_value`. If it returns false, some rows
+  // may still not satisfy the predicate. As comparisons with NULL are never true, segments that hold nothing but NULLs
+  // can always be pruned. Search values that are NULL or of another data type than the segment are not pruned on.
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns the smallest value of the segment, or NULL_VALUE if it holds no values other than NULL. NaNs are not
+  // ordered and thus not part of the range.
+  virtual AllTypeVariant min() const = 0;
+
+  // Returns the largest value of the segment, or NULL_VALUE if it holds no values other than NULL.
+  virtual AllTypeVariant max() const = 0;
+
+  // Returns the number of NULL values in the segment.
+  virtual ChunkOffset null_count() const = 0;
+};
+
+// A ZoneMap stores the minimum, the maximum, and the number of NULLs of a segment, so that scans can skip segments (and
+// thus whole chunks) whose range of values cannot satisfy their predicate. For data that is loaded roughly in order of
+// a column, e.g., a timestamp, the ranges of the chunks hardly overlap and most chunks are skipped.
+template <typename T>
+class ZoneMap : public BaseZoneMap {
+ public:
+  // Creates the zone map of an empty segment.
+  ZoneMap() = default;
+
+  // Creates the zone map of the given segment, which may use any encoding.
+  explicit ZoneMap(const AbstractSegment& segment);
+
+  void append(const AllTypeVariant& value) final;
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  AllTypeVariant min() const final;
+
+  AllTypeVariant max() const final;
+
+  ChunkOffset null_count() const final;
+
+ protected:
+  // Extends the range of values by a value that is not NULL. NaNs are only recorded in _contains_nan, as they compare
+  // false with everything and would otherwise never be replaced as the first minimum or maximum.
+  template <typename Value>
+  void _add_value(const Value& value);
+
+  // Both are std::nullopt as long as the segment holds no values other than NULL and NaN.
+  std::optional<T> _min;
+  std::optional<T> _max;
+  ChunkOffset _null_count{0};
+
+  // NaN satisfies `NaN != search_value`, so segments holding NaNs are never pruned for OpNotEquals.
+  bool _contains_nan{false};
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
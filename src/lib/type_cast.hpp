@@ -22,6 +22,12 @@ constexpr auto index_of(Sequence const& sequence, T const& element) {
   return static_cast<size_t>(decltype(size)::value);
 }
 
+// int8_t is a character type, so streams (and thereby boost::lexical_cast) would read and write it as a character
+// instead of a number. Conversions from and to int8_t thus go through int16_t.
+inline bool holds_int8(const AllTypeVariant& value) {
+  return static_cast<size_t>(value.which()) == index_of(types_including_null, hana::type_c<int8_t>);
+}
+
 }  // namespace detail
 
 // Retrieves the value stored in an AllTypeVariant without conversion
@@ -40,6 +46,10 @@ std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant&
     return get<T>(value);
   }
 
+  if (detail::holds_int8(value)) {
+    return type_cast<T>(AllTypeVariant{int16_t{get<int8_t>(value)}});
+  }
+
   return boost::lexical_cast<T>(value);
 }
 
@@ -50,6 +60,14 @@ std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant&
     return get<T>(value);
   }
 
+  if constexpr (std::is_same_v<T, int8_t>) {
+    return boost::numeric_cast<int8_t>(type_cast<int16_t>(value));
+  }
+
+  if (detail::holds_int8(value)) {
+    return type_cast<T>(AllTypeVariant{int16_t{get<int8_t>(value)}});
+  }
+
   try {
     return boost::lexical_cast<T>(value);
   } catch (...) {
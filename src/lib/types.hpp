@@ -71,6 +71,23 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// In a sorted segment, NULLs come first, followed by the values in ascending or descending order.
+enum class SortMode { Ascending, Descending };
+
+// Describes a column by which the rows of a chunk are sorted.
+struct SortColumnDefinition {
+  ColumnID column;
+  SortMode sort_mode{SortMode::Ascending};
+
+  bool operator==(const SortColumnDefinition& rhs) const {
+    return std::tie(column, sort_mode) == std::tie(rhs.column, rhs.sort_mode);
+  }
+};
+
+// Determines how the value ids of a DictionarySegment are stored: FixedWidthInteger uses 8, 16, or 32 bits per value
+// id, BitPacked uses exactly as many bits as the largest value id requires.
+enum class VectorCompressionType { FixedWidthInteger, BitPacked };
+
 using PosList = std::vector<RowID>;
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
@@ -6,6 +6,7 @@
 
 #include "resolve_type.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace {
@@ -34,13 +35,15 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
   std::getline(infile, line);
   const auto column_names = split(line, '|');
   std::getline(infile, line);
-  const auto column_types = split(line, '|');
+  const auto column_type_strings = split(line, '|');
 
   const auto table = std::make_shared<Table>(chunk_size);
   const auto column_count = column_names.size();
-  Assert(column_types.size() == column_count, "Mismatching number of column types.");
+  Assert(column_type_strings.size() == column_count, "Mismatching number of column types.");
+  auto column_data_types = std::vector<DataType>{};
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    table->add_column(column_names[column_id], column_types[column_id], false);
+    column_data_types.push_back(data_type_from_string(column_type_strings[column_id]));
+    table->add_column(column_names[column_id], column_data_types[column_id], false);
   }
 
   while (std::getline(infile, line)) {
@@ -50,9 +53,9 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     variant_values.reserve(column_count);
 
     for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      resolve_data_type(column_types[column_id], [&](auto data_type_t) {
+      resolve_data_type(column_data_types[column_id], [&](auto data_type_t) {
         using ColumnDataType = typename decltype(data_type_t)::type;
-        variant_values.emplace_back(boost::lexical_cast<ColumnDataType>(string_values[column_id]));
+        variant_values.emplace_back(type_cast<ColumnDataType>(AllTypeVariant{string_values[column_id]}));
       });
     }
 
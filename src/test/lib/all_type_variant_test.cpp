@@ -1,11 +1,18 @@
+#include <boost/hana/equal.hpp>
+#include <boost/hana/for_each.hpp>
+
 #include "base_test.hpp"
 
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
 namespace opossum {
 
 template <typename T>
 class AllTypeVariantTest : public BaseTest {};
 
-using AllTypeVariantTestDataTypes = ::testing::Types<int32_t, int64_t, float, double, std::string, NullValue>;
+using AllTypeVariantTestDataTypes =
+    ::testing::Types<int32_t, int64_t, float, double, std::string, int8_t, int16_t, NullValue>;
 TYPED_TEST_SUITE(AllTypeVariantTest, AllTypeVariantTestDataTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(AllTypeVariantTest, GetExtractsExactValue) {
@@ -42,4 +49,32 @@ TYPED_TEST(AllTypeVariantTest, GetExtractsExactValue) {
   }
 }
 
+TEST(DataTypeTest, ConversionAndResolution) {
+  EXPECT_EQ(data_type_from_string("int"), DataType::Int);
+  EXPECT_EQ(data_type_from_string("decimal"), DataType::Decimal);
+  EXPECT_EQ(data_type_to_string(DataType::String), "string");
+  EXPECT_THROW(data_type_from_string("varchar"), std::logic_error);
+
+  // The value of each DataType is the index of its type in `types`.
+  auto index = size_t{0};
+  hana::for_each(data_types, [&](const auto data_type_pair) {
+    const auto data_type = static_cast<DataType>(index++);
+    EXPECT_EQ(data_type_to_string(data_type), hana::first(data_type_pair));
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      EXPECT_TRUE(data_type_t == hana::second(data_type_pair));
+    });
+  });
+  EXPECT_EQ(index, static_cast<size_t>(DataType::Decimal) + 1);
+}
+
+TEST(AllTypeVariantSmallIntegerTest, TypeCast) {
+  // int8_t is a character type for streams, but has to be converted as a number.
+  EXPECT_EQ(type_cast<int8_t>(AllTypeVariant{"5"}), int8_t{5});
+  EXPECT_EQ(type_cast<int8_t>(AllTypeVariant{-128}), int8_t{-128});
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{int8_t{5}}), "5");
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int8_t{-5}}), -5);
+  EXPECT_EQ(type_cast<int16_t>(AllTypeVariant{"-32768"}), int16_t{-32768});
+  EXPECT_THROW(type_cast<int8_t>(AllTypeVariant{200}), boost::numeric::bad_numeric_cast);
+}
+
 }  // namespace opossum
@@ -0,0 +1,52 @@
+#include "base_test.hpp"
+
+#include "date_time_types.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class DateTimeTypesTest : public BaseTest {};
+
+TEST_F(DateTimeTypesTest, Date) {
+  EXPECT_EQ(Date::from_year_month_day(1970, 1, 1).days_since_epoch(), 0);
+  EXPECT_EQ(Date::from_year_month_day(2000, 3, 1).days_since_epoch(), 11'017);
+  EXPECT_EQ(Date::from_year_month_day(1969, 12, 31).days_since_epoch(), -1);
+  EXPECT_THROW(Date::from_year_month_day(2023, 2, 29), std::logic_error);
+
+  EXPECT_LT(Date::from_year_month_day(1999, 12, 31), Date::from_year_month_day(2000, 1, 1));
+  EXPECT_EQ(boost::lexical_cast<std::string>(Date{11'017}), "2000-03-01");
+  EXPECT_EQ(boost::lexical_cast<std::string>(Date{-1}), "1969-12-31");
+
+  EXPECT_EQ(boost::lexical_cast<Date>("2024-02-29"), Date::from_year_month_day(2024, 2, 29));
+  EXPECT_THROW(boost::lexical_cast<Date>("2023-02-29"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Date>("2023-2-28"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Date>("2023-02-28x"), boost::bad_lexical_cast);
+}
+
+TEST_F(DateTimeTypesTest, Timestamp) {
+  const auto date = Date::from_year_month_day(2021, 6, 15);
+  EXPECT_EQ(Timestamp::from_date(date).date(), date);
+  EXPECT_EQ(Timestamp{-1}.date(), Date{-1});
+
+  EXPECT_EQ(boost::lexical_cast<std::string>(Timestamp::from_date(date)), "2021-06-15 00:00:00");
+  EXPECT_EQ(boost::lexical_cast<std::string>(Timestamp{-1}), "1969-12-31 23:59:59.999999");
+  EXPECT_EQ(boost::lexical_cast<std::string>(Timestamp{Timestamp::MICROSECONDS_PER_DAY + 3'723'500'000}),
+            "1970-01-02 01:02:03.5");
+
+  const auto timestamp = Timestamp{Timestamp::from_date(date).microseconds_since_epoch() + 45'296'120'000};
+  EXPECT_EQ(boost::lexical_cast<Timestamp>("2021-06-15 12:34:56.12"), timestamp);
+  EXPECT_EQ(boost::lexical_cast<Timestamp>("2021-06-15T12:34:56.120000"), timestamp);
+  EXPECT_EQ(boost::lexical_cast<Timestamp>("2021-06-15"), Timestamp::from_date(date));
+  EXPECT_THROW(boost::lexical_cast<Timestamp>("2021-06-15 24:00:00"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Timestamp>("2021-06-15 12:34:56.1234567"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Timestamp>("2021-06-15 12:34"), boost::bad_lexical_cast);
+}
+
+TEST_F(DateTimeTypesTest, TypeCast) {
+  const auto date = Date::from_year_month_day(2022, 1, 31);
+  EXPECT_EQ(type_cast<Date>(AllTypeVariant{"2022-01-31"}), date);
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{date}), "2022-01-31");
+  EXPECT_EQ(type_cast<Timestamp>(AllTypeVariant{date}), Timestamp::from_date(date));
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#include "base_test.hpp"
+
+#include "decimal.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class DecimalTest : public BaseTest {};
+
+TEST_F(DecimalTest, ReadAndPrint) {
+  EXPECT_EQ(boost::lexical_cast<Decimal>("12.5"), Decimal::from_unscaled(125'000));
+  EXPECT_EQ(boost::lexical_cast<Decimal>("-0.0001"), Decimal::from_unscaled(-1));
+  EXPECT_EQ(boost::lexical_cast<Decimal>("+3"), Decimal::from_unscaled(30'000));
+  EXPECT_EQ(boost::lexical_cast<Decimal>(".25"), Decimal::from_unscaled(2'500));
+  EXPECT_EQ(boost::lexical_cast<Decimal>("-922337203685477.5808"),
+            Decimal::from_unscaled(std::numeric_limits<int64_t>::min()));
+
+  EXPECT_THROW(boost::lexical_cast<Decimal>("1.23456"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Decimal>("922337203685477.5808"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Decimal>("1e5"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Decimal>("-"), boost::bad_lexical_cast);
+  EXPECT_THROW(boost::lexical_cast<Decimal>("1.2.3"), boost::bad_lexical_cast);
+
+  EXPECT_EQ(boost::lexical_cast<std::string>(Decimal::from_unscaled(125'000)), "12.5");
+  EXPECT_EQ(boost::lexical_cast<std::string>(Decimal::from_unscaled(-1)), "-0.0001");
+  EXPECT_EQ(boost::lexical_cast<std::string>(Decimal::from_unscaled(-30'000)), "-3");
+  EXPECT_EQ(boost::lexical_cast<std::string>(Decimal::from_unscaled(std::numeric_limits<int64_t>::min())),
+            "-922337203685477.5808");
+}
+
+TEST_F(DecimalTest, ExactArithmetic) {
+  // Ten times 0.1 is exactly 1, unlike with doubles.
+  auto sum = int64_t{0};
+  for (auto index = 0; index < 10; ++index) {
+    sum += boost::lexical_cast<Decimal>("0.1").unscaled_value();
+  }
+  EXPECT_EQ(Decimal::from_unscaled(sum), boost::lexical_cast<Decimal>("1"));
+  EXPECT_LT(boost::lexical_cast<Decimal>("-1.5"), boost::lexical_cast<Decimal>("-1.4"));
+  EXPECT_DOUBLE_EQ(Decimal::from_unscaled(-125'000).to_double(), -12.5);
+
+  EXPECT_EQ(type_cast<Decimal>(AllTypeVariant{19.99}), Decimal::from_unscaled(199'900));
+  EXPECT_EQ(type_cast<Decimal>(AllTypeVariant{int8_t{-7}}), Decimal::from_unscaled(-70'000));
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{Decimal::from_unscaled(199'900)}), 19.99);
+}
+
+}  // namespace opossum
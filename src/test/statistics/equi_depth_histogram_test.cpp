@@ -0,0 +1,114 @@
+#include "base_test.hpp"
+
+#include <random>
+
+#include "statistics/equi_depth_histogram.hpp"
+
+namespace opossum {
+
+class EquiDepthHistogramTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 0, 1, ..., 999, and 640 times the value 500.
+    for (auto value = int32_t{0}; value < 1'000; ++value) {
+      values.push_back(value);
+    }
+    values.insert(values.end(), 640, 500);
+    std::sort(values.begin(), values.end());
+  }
+
+  std::vector<int32_t> values;
+};
+
+TEST_F(EquiDepthHistogramTest, Bins) {
+  const auto histogram = EquiDepthHistogram<int32_t>{values};
+  EXPECT_EQ(histogram.total_count(), 1'640);
+  EXPECT_LE(histogram.bins().size(), EquiDepthHistogram<int32_t>::MAX_BIN_COUNT);
+
+  // The frequent value is not split, so it gets a bin of its own.
+  const auto& bins = histogram.bins();
+  const auto frequent_bin = std::find_if(bins.begin(), bins.end(), [](const auto& bin) { return bin.max == 500; });
+  ASSERT_NE(frequent_bin, bins.end());
+  EXPECT_EQ(std::next(frequent_bin)->min, 501);
+  EXPECT_EQ(bins.front().min, 0);
+  EXPECT_EQ(bins.back().max, 999);
+
+  EXPECT_TRUE(EquiDepthHistogram<int32_t>{std::vector<int32_t>{}}.bins().empty());
+}
+
+TEST_F(EquiDepthHistogramTest, EstimateCount) {
+  const auto histogram = EquiDepthHistogram<int32_t>{values};
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpEquals, 500), 641.0, 20.0);
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpEquals, 100), 1.0, 0.5);
+  EXPECT_EQ(histogram.estimate_count(ScanType::OpEquals, 1'000), 0.0);
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpNotEquals, 500), 999.0, 20.0);
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpLessThan, 250), 250.0, 10.0);
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpLessThanEquals, 500), 1'141.0, 10.0);
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpGreaterThan, 500), 499.0, 10.0);
+  EXPECT_EQ(histogram.estimate_count(ScanType::OpGreaterThanEquals, 0), 1'640.0);
+  EXPECT_EQ(histogram.estimate_count(ScanType::OpLessThan, 0), 0.0);
+
+  const auto string_histogram = EquiDepthHistogram<std::string>{std::vector<std::string>{"a", "b", "c", "d"}};
+  EXPECT_EQ(string_histogram.estimate_count(ScanType::OpGreaterThan, "d"), 0.0);
+  EXPECT_GT(string_histogram.estimate_count(ScanType::OpLessThan, "c"), 0.0);
+}
+
+TEST_F(EquiDepthHistogramTest, Merge) {
+  const auto first_half = std::vector<int32_t>(values.begin(), values.begin() + 820);
+  const auto second_half = std::vector<int32_t>(values.begin() + 820, values.end());
+  const auto first_histogram = EquiDepthHistogram<int32_t>{first_half};
+  const auto second_histogram = EquiDepthHistogram<int32_t>{second_half};
+
+  // The value 500 is in both halves, so the distinct counts of the bins have to be scaled down.
+  const auto histogram = EquiDepthHistogram<int32_t>{{&first_histogram, &second_histogram}, 1'000.0};
+  EXPECT_EQ(histogram.total_count(), 1'640);
+  EXPECT_LE(histogram.bins().size(), EquiDepthHistogram<int32_t>::MAX_BIN_COUNT);
+  auto distinct_count = uint64_t{0};
+  for (const auto& bin : histogram.bins()) {
+    distinct_count += bin.distinct_count;
+  }
+  EXPECT_NEAR(static_cast<double>(distinct_count), 1'000.0, 32.0);
+
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpLessThan, 250), 250.0, 10.0);
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpGreaterThanEquals, 800), 200.0, 10.0);
+}
+
+TEST_F(EquiDepthHistogramTest, MergeOverlappingChunks) {
+  // Eight chunks hold a random eighth of the values 0, 2, ..., 19'998 each, so all of them span the whole range.
+  auto shuffled_values = std::vector<int32_t>{};
+  for (auto value = int32_t{0}; value < 20'000; value += 2) {
+    shuffled_values.push_back(value);
+  }
+  std::shuffle(shuffled_values.begin(), shuffled_values.end(), std::mt19937{42});
+
+  constexpr auto CHUNK_COUNT = size_t{8};
+  const auto chunk_size = shuffled_values.size() / CHUNK_COUNT;
+  auto chunk_histograms = std::vector<EquiDepthHistogram<int32_t>>{};
+  for (auto chunk_index = size_t{0}; chunk_index < CHUNK_COUNT; ++chunk_index) {
+    const auto chunk_begin = shuffled_values.begin() + static_cast<std::ptrdiff_t>(chunk_index * chunk_size);
+    auto chunk_values = std::vector<int32_t>(chunk_begin, chunk_begin + static_cast<std::ptrdiff_t>(chunk_size));
+    std::sort(chunk_values.begin(), chunk_values.end());
+    chunk_histograms.emplace_back(chunk_values);
+  }
+  auto histogram_pointers = std::vector<const EquiDepthHistogram<int32_t>*>{};
+  for (const auto& chunk_histogram : chunk_histograms) {
+    histogram_pointers.push_back(&chunk_histogram);
+  }
+
+  const auto histogram = EquiDepthHistogram<int32_t>{histogram_pointers, 10'000.0};
+  EXPECT_EQ(histogram.total_count(), 10'000);
+  EXPECT_GE(histogram.bins().size(), EquiDepthHistogram<int32_t>::MAX_BIN_COUNT * 3 / 4);
+  EXPECT_LE(histogram.bins().size(), EquiDepthHistogram<int32_t>::MAX_BIN_COUNT);
+  auto height = uint64_t{0};
+  for (const auto& bin : histogram.bins()) {
+    height += bin.height;
+  }
+  EXPECT_EQ(height, 10'000);
+
+  for (const auto search_value : {1'000, 5'001, 12'345, 19'000}) {
+    EXPECT_NEAR(histogram.estimate_count(ScanType::OpLessThan, search_value), search_value / 2.0, 100.0);
+  }
+  EXPECT_NEAR(histogram.estimate_count(ScanType::OpEquals, 5'000), 1.0, 0.5);
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include "base_test.hpp"
+
+#include "statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public BaseTest {};
+
+TEST_F(HyperLogLogTest, Estimate) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0.0);
+
+  // Duplicates do not change the sketch.
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = int64_t{0}; value < 100; ++value) {
+      sketch.insert(value);
+    }
+  }
+  EXPECT_NEAR(sketch.estimate(), 100.0, 5.0);
+
+  for (auto value = int64_t{0}; value < 100'000; ++value) {
+    sketch.insert(value * 1024);
+  }
+  EXPECT_NEAR(sketch.estimate(), 100'100.0, 10'000.0);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sketch = HyperLogLog{};
+  auto other_sketch = HyperLogLog{};
+  for (auto value = 0; value < 20'000; ++value) {
+    sketch.insert(std::string{"value_"} + std::to_string(value));
+    // Half of the values are in both sketches. Strings hash equal to string_views.
+    other_sketch.insert(std::string_view{std::string{"value_"} + std::to_string(value + 10'000)});
+  }
+
+  sketch.merge(other_sketch);
+  EXPECT_NEAR(sketch.estimate(), 30'000.0, 3'000.0);
+  EXPECT_EQ(sketch.estimate_memory_usage(), sizeof(HyperLogLog) + 1024);
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "base_test.hpp"
+
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table.add_column("id", DataType::Int, false);
+    table.add_column("name", DataType::String, true);
+    for (auto id = int32_t{0}; id < 1'000; ++id) {
+      table.append({id, id % 4 == 0 ? NULL_VALUE : AllTypeVariant{"name_" + std::to_string(id % 50)}});
+    }
+  }
+
+  Table table{300};
+};
+
+TEST_F(TableStatisticsTest, ColumnStatistics) {
+  const auto statistics = TableStatistics{table};
+  EXPECT_EQ(statistics.row_count(), 1'000);
+  EXPECT_EQ(statistics.chunk_statistics().size(), 4);
+
+  const auto id_statistics = statistics.column_statistics(ColumnID{0});
+  EXPECT_EQ(id_statistics->null_count(), 0);
+  EXPECT_NEAR(id_statistics->distinct_count(), 1'000.0, 50.0);
+  EXPECT_EQ(id_statistics->average_string_length(), 0.0);
+
+  // The names are name_0 to name_49. Ids that are multiples of 4 are NULL.
+  const auto name_statistics = statistics.column_statistics(ColumnID{1});
+  EXPECT_EQ(name_statistics->null_fraction(), 0.25);
+  EXPECT_NEAR(name_statistics->distinct_count(), 50.0, 3.0);
+  EXPECT_NEAR(name_statistics->average_string_length(), 6.7, 0.1);
+  EXPECT_THROW(statistics.column_statistics(ColumnID{2}), std::logic_error);
+}
+
+TEST_F(TableStatisticsTest, EstimateSelectivity) {
+  const auto statistics = TableStatistics{table};
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 100), 0.1, 0.01);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 100), 0.9, 0.01);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 100), 0.001, 0.001);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpNotEquals, 100), 0.999, 0.001);
+  EXPECT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThan, 999), 0.0);
+  EXPECT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, NULL_VALUE), 0.0);
+
+  // NULLs never match, so the selectivities of a predicate and its negation add up to the non-NULL fraction.
+  const auto equals = statistics.estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "name_7");
+  const auto not_equals = statistics.estimate_selectivity(ColumnID{1}, ScanType::OpNotEquals, "name_7");
+  EXPECT_NEAR(equals, 0.02, 0.01);
+  EXPECT_NEAR(equals + not_equals, 0.75, 0.001);
+}
+
+TEST_F(TableStatisticsTest, RefreshOnCompression) {
+  EXPECT_FALSE(table.statistics());
+  table.generate_statistics();
+  const auto statistics = table.statistics();
+  ASSERT_TRUE(statistics);
+
+  // Rows are only reflected once their chunk is compressed. The rows of the new last chunk are not.
+  for (auto id = int32_t{1'000}; id < 1'300; ++id) {
+    table.append({id, NULL_VALUE});
+  }
+  EXPECT_EQ(table.statistics(), statistics);
+  table.compress_chunk(ChunkID{3});
+
+  const auto refreshed_statistics = table.statistics();
+  EXPECT_NE(refreshed_statistics, statistics);
+  EXPECT_EQ(refreshed_statistics->row_count(), 1'200);
+  EXPECT_EQ(refreshed_statistics->chunk_statistics()[0], statistics->chunk_statistics()[0]);
+  EXPECT_TRUE(refreshed_statistics->chunk_statistics()[4].empty());
+  EXPECT_NEAR(refreshed_statistics->column_statistics(ColumnID{1})->null_fraction(), 450.0 / 1'200.0, 0.001);
+  EXPECT_NEAR(refreshed_statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 1'000),
+              1.0 / 6.0, 0.01);
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#include "base_test.hpp"
+
+#include <cmath>
+
+#include "storage/alp_segment.hpp"
+
+namespace opossum {
+
+class StorageALPSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<double>> value_segment_double{std::make_shared<ValueSegment<double>>(true)};
+  std::shared_ptr<ValueSegment<float>> value_segment_float{std::make_shared<ValueSegment<float>>()};
+};
+
+TEST_F(StorageALPSegmentTest, CompressSegment) {
+  value_segment_double->append(12.34);
+  value_segment_double->append(-0.5);
+  value_segment_double->append(NULL_VALUE);
+  value_segment_double->append(100.0);
+
+  const auto segment = std::make_shared<ALPSegment<double>>(value_segment_double);
+  EXPECT_EQ(segment->size(), 4);
+  EXPECT_TRUE(segment->exception_positions().empty());
+
+  EXPECT_EQ(segment->get(0), 12.34);
+  EXPECT_EQ(segment->get(1), -0.5);
+  EXPECT_EQ(segment->get_typed_value(2), std::nullopt);
+  EXPECT_EQ(segment->get(3), 100.0);
+  EXPECT_TRUE(variant_is_null((*segment)[2]));
+  EXPECT_EQ((*segment)[0], AllTypeVariant{12.34});
+  EXPECT_THROW(segment->get(2), std::logic_error);
+}
+
+TEST_F(StorageALPSegmentTest, Exceptions) {
+  value_segment_double->append(1.5);
+  value_segment_double->append(M_PI);
+  value_segment_double->append(std::nan(""));
+  value_segment_double->append(-0.0);
+  value_segment_double->append(std::numeric_limits<double>::infinity());
+  value_segment_double->append(2.25);
+
+  const auto segment = std::make_shared<ALPSegment<double>>(value_segment_double);
+  EXPECT_EQ(segment->exception_positions(), (std::vector<ChunkOffset>{1, 2, 3, 4}));
+
+  EXPECT_EQ(segment->get(0), 1.5);
+  EXPECT_EQ(segment->get(1), M_PI);
+  EXPECT_TRUE(std::isnan(segment->get(2)));
+  EXPECT_EQ(segment->get(3), 0.0);
+  EXPECT_TRUE(std::signbit(segment->get(3)));
+  EXPECT_EQ(segment->get(4), std::numeric_limits<double>::infinity());
+  EXPECT_EQ(segment->get(5), 2.25);
+}
+
+TEST_F(StorageALPSegmentTest, FloatValues) {
+  value_segment_float->append(3.7f);
+  value_segment_float->append(-21.05f);
+  value_segment_float->append(0.0f);
+
+  const auto segment = std::make_shared<ALPSegment<float>>(value_segment_float);
+  EXPECT_TRUE(segment->exception_positions().empty());
+  EXPECT_EQ(segment->get(0), 3.7f);
+  EXPECT_EQ(segment->get(1), -21.05f);
+  EXPECT_EQ(segment->get(2), 0.0f);
+}
+
+TEST_F(StorageALPSegmentTest, MultipleBlocksAndDecode) {
+  const auto row_count = ChunkOffset{5000};
+  auto values = std::vector<double>{};
+  for (auto index = ChunkOffset{0}; index < row_count; ++index) {
+    // Prices with two decimal places, plus a few values that cannot be encoded.
+    values.push_back(index % 997 == 0 ? std::sqrt(index + 2.0) : static_cast<double>((index * 7919) % 100'000) / 100);
+    value_segment_double->append(values.back());
+  }
+
+  const auto segment = std::make_shared<ALPSegment<double>>(value_segment_double);
+  EXPECT_EQ(segment->exception_positions().size(), 6);
+
+  auto decoded = std::vector<double>(row_count - 100);
+  segment->decode(100, row_count, decoded.data());
+  for (auto index = ChunkOffset{0}; index < row_count; ++index) {
+    EXPECT_EQ(segment->get(index), values[index]);
+    if (index >= 100) {
+      EXPECT_EQ(decoded[index - 100], values[index]);
+    }
+  }
+}
+
+TEST_F(StorageALPSegmentTest, MemoryUsage) {
+  for (auto index = 0; index < 10'000; ++index) {
+    value_segment_double->append(20.0 + static_cast<double>(index % 1000) / 10);
+  }
+
+  const auto segment = std::make_shared<ALPSegment<double>>(value_segment_double);
+  EXPECT_TRUE(segment->exception_positions().empty());
+  // Values are in [20.0, 119.9], i.e., 1000 distinct integers after scaling, which need 10 bits each.
+  EXPECT_LT(segment->estimate_memory_usage(), value_segment_double->estimate_memory_usage() / 4);
+}
+
+}  // namespace opossum
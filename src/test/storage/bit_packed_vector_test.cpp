@@ -0,0 +1,69 @@
+#include "base_test.hpp"
+
+#include "storage/bit_packed_vector.hpp"
+
+namespace opossum {
+
+class BitPackedVectorTest : public BaseTest {};
+
+TEST_F(BitPackedVectorTest, BasicOperations) {
+  auto vector = BitPackedVector{5, 3};
+  for (auto index = size_t{0}; index < 5; ++index) {
+    vector.set(index, static_cast<ValueID>(index + 3));
+  }
+
+  for (auto index = size_t{0}; index < 5; ++index) {
+    EXPECT_EQ(vector.get(index), static_cast<ValueID>(index + 3));
+  }
+
+  EXPECT_EQ(vector.size(), 5);
+  EXPECT_EQ(vector.bit_width(), 3);
+  EXPECT_EQ(vector.width(), 1);
+}
+
+TEST_F(BitPackedVectorTest, OverwriteDoesNotAffectNeighbours) {
+  auto vector = BitPackedVector{3, 7};
+  vector.set(0, ValueID{127});
+  vector.set(1, ValueID{127});
+  vector.set(2, ValueID{127});
+  vector.set(1, ValueID{0});
+
+  EXPECT_EQ(vector.get(0), ValueID{127});
+  EXPECT_EQ(vector.get(1), ValueID{0});
+  EXPECT_EQ(vector.get(2), ValueID{127});
+}
+
+TEST_F(BitPackedVectorTest, AllBitWidths) {
+  const auto element_count = size_t{100};
+  for (auto bit_width = uint8_t{1}; bit_width <= 32; ++bit_width) {
+    const auto max_value = (uint64_t{1} << bit_width) - 1;
+    auto vector = BitPackedVector{element_count, bit_width};
+    for (auto index = size_t{0}; index < element_count; ++index) {
+      vector.set(index, static_cast<ValueID>((index * 2654435761u) & max_value));
+    }
+
+    auto decoded = std::vector<ValueID::base_type>(element_count - 3);
+    vector.decode(3, element_count, decoded.data());
+    for (auto index = size_t{0}; index < element_count; ++index) {
+      const auto expected = static_cast<ValueID>((index * 2654435761u) & max_value);
+      EXPECT_EQ(vector.get(index), expected) << "bit width " << static_cast<int>(bit_width);
+      if (index >= 3) {
+        EXPECT_EQ(decoded[index - 3], expected) << "bit width " << static_cast<int>(bit_width);
+      }
+    }
+  }
+}
+
+TEST_F(BitPackedVectorTest, MemoryUsage) {
+  // 1000 values with 10 bits each need 157 64-bit words plus one word of padding.
+  const auto vector = BitPackedVector{1000, 10};
+  EXPECT_EQ(vector.estimate_memory_usage(), 158 * sizeof(uint64_t));
+  EXPECT_EQ(vector.width(), 2);
+}
+
+TEST_F(BitPackedVectorTest, InvalidBitWidth) {
+  EXPECT_THROW(BitPackedVector(10, 0), std::logic_error);
+  EXPECT_THROW(BitPackedVector(10, 33), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#include "base_test.hpp"
+
+#include "storage/bloom_filter.hpp"
+#include "storage/segment_encoding.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto value = int32_t{0}; value < 10'000; ++value) {
+      int_segment->append(value * 7);
+      string_segment->append("key_" + std::to_string(value * 7));
+    }
+    int_segment->append(NULL_VALUE);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> int_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  std::shared_ptr<ValueSegment<std::string>> string_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength}) {
+    const auto int_filter = BloomFilter<int32_t>{*encode_segment(int_segment, DataType::Int, {encoding_type})};
+    const auto string_filter =
+        BloomFilter<std::string>{*encode_segment(string_segment, DataType::String, {encoding_type})};
+    for (auto value = int32_t{0}; value < 10'000; ++value) {
+      EXPECT_TRUE(int_filter.may_contain_typed(value * 7));
+      EXPECT_TRUE(string_filter.may_contain(AllTypeVariant{"key_" + std::to_string(value * 7)}));
+    }
+  }
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  const auto int_filter = BloomFilter<int32_t>{*int_segment};
+  const auto string_filter = BloomFilter<std::string>{*string_segment};
+  auto int_false_positives = size_t{0};
+  auto string_false_positives = size_t{0};
+  for (auto value = int32_t{0}; value < 70'000; ++value) {
+    if (value % 7 != 0) {
+      int_false_positives += int_filter.may_contain_typed(value);
+      string_false_positives += string_filter.may_contain_typed("key_" + std::to_string(value));
+    }
+  }
+
+  // 60'000 values are not contained. The expected rate is about 0.1 %, which leaves ample room for bad luck.
+  EXPECT_LT(int_false_positives, 600);
+  EXPECT_LT(string_false_positives, 600);
+  EXPECT_EQ(int_filter.estimate_memory_usage(), sizeof(int_filter) + 313 * 64);
+}
+
+TEST_F(StorageBloomFilterTest, UnprunableSearchValues) {
+  const auto int_filter = BloomFilter<int32_t>{*int_segment};
+  EXPECT_TRUE(int_filter.may_contain(NULL_VALUE));
+  EXPECT_TRUE(int_filter.may_contain(int64_t{1}));
+
+  const auto empty_filter = BloomFilter<int32_t>{ValueSegment<int32_t>{}};
+  EXPECT_FALSE(empty_filter.may_contain(1));
+}
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
 
 namespace opossum {
 
@@ -66,6 +67,30 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, AppendToEncodedSegment) {
+  chunk.add_segment(std::make_shared<DictionarySegment<int32_t>>(int32_value_segment));
+  EXPECT_THROW(chunk.append({4}), std::logic_error);
+}
+
+TEST_F(StorageChunkTest, AppendToSortedChunk) {
+  chunk.add_segment(int32_value_segment);
+  chunk.add_segment(int64_value_segment);
+  chunk.set_individually_sorted_by({{ColumnID{0}, SortMode::Descending}, {ColumnID{1}, SortMode::Ascending}});
+
+  // Appended rows are compared with the last row the chunk held when the order was declared.
+  chunk.append({3, 7});
+  EXPECT_EQ(chunk.sort_mode(ColumnID{0}), SortMode::Descending);
+  EXPECT_EQ(chunk.sort_mode(ColumnID{1}), SortMode::Ascending);
+
+  chunk.append({1, 5});
+  EXPECT_EQ(chunk.sort_mode(ColumnID{0}), SortMode::Descending);
+  EXPECT_EQ(chunk.sort_mode(ColumnID{1}), std::nullopt);
+
+  chunk.append({0, 9});
+  chunk.append({2, 9});
+  EXPECT_TRUE(chunk.individually_sorted_by().empty());
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   chunk.add_segment(int32_value_segment);
   chunk.add_segment(string_value_segment);
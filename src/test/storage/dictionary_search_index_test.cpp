@@ -0,0 +1,98 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_search_index.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+class StorageDictionarySearchIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Odd values leave gaps for searching values that the dictionary does not contain.
+    for (auto value = int32_t{-1001}; value < 1000; value += 2) {
+      values.push_back(value);
+    }
+  }
+
+  std::vector<int32_t> values;
+};
+
+TEST_F(StorageDictionarySearchIndexTest, SearchValues) {
+  // Sizes that fill the last level of the tree partially, completely, and not at all are searched alike.
+  for (const auto size : {size_t{0}, size_t{1}, size_t{7}, size_t{8}, size_t{100}, values.size()}) {
+    const auto sorted_values = std::vector<int32_t>(values.begin(), values.begin() + size);
+    const auto search_index = DictionarySearchIndex<int32_t>{sorted_values};
+    EXPECT_EQ(search_index.size(), size);
+
+    auto search_values = std::vector<int32_t>{};
+    for (auto value = int32_t{-1003}; value <= 1001; ++value) {
+      search_values.push_back(value);
+    }
+    auto positions = std::vector<size_t>(search_values.size());
+    search_index.lower_bound(search_values.data(), search_values.size(), positions.data());
+
+    for (auto index = size_t{0}; index < search_values.size(); ++index) {
+      const auto value = search_values[index];
+      const auto lower_bound = std::lower_bound(sorted_values.begin(), sorted_values.end(), value);
+      const auto expected_lower_bound = static_cast<size_t>(std::distance(sorted_values.begin(), lower_bound));
+      const auto expected_upper_bound = static_cast<size_t>(
+          std::distance(sorted_values.begin(), std::upper_bound(sorted_values.begin(), sorted_values.end(), value)));
+      const auto is_contained = lower_bound != sorted_values.end() && *lower_bound == value;
+
+      EXPECT_EQ(search_index.lower_bound(value), expected_lower_bound);
+      EXPECT_EQ(positions[index], expected_lower_bound);
+      EXPECT_EQ(search_index.upper_bound(value), expected_upper_bound);
+      EXPECT_EQ(search_index.find(value), is_contained ? expected_lower_bound : size);
+    }
+  }
+}
+
+TEST_F(StorageDictionarySearchIndexTest, FloatingPointValues) {
+  const auto sorted_values = std::vector<double>{-2.5, -0.0, 0.5, 1e10};
+  const auto search_index = DictionarySearchIndex<double>{sorted_values};
+  EXPECT_EQ(search_index.find(0.0), 1);
+  EXPECT_EQ(search_index.find(0.25), 4);
+  EXPECT_EQ(search_index.lower_bound(0.25), 2);
+  EXPECT_EQ(search_index.upper_bound(1e10), 4);
+}
+
+TEST_F(StorageDictionarySearchIndexTest, UsedByLargeDictionarySegments) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  value_segment->append(NULL_VALUE);
+  for (auto value = int32_t{0}; value < 3 * static_cast<int32_t>(DictionarySearchIndex<int32_t>::MIN_DICTIONARY_SIZE);
+       value += 3) {
+    value_segment->append(value);
+  }
+  const auto dictionary_segment = DictionarySegment<int32_t>{value_segment};
+  ASSERT_TRUE(dictionary_segment.search_index());
+  EXPECT_GT(dictionary_segment.estimate_memory_usage(),
+            dictionary_segment.search_index()->estimate_memory_usage() + dictionary_segment.size() * sizeof(int32_t));
+
+  // Range searches do not need the hash table, so it is only built by the first equality search.
+  const auto index_memory_usage = dictionary_segment.search_index()->estimate_memory_usage();
+  EXPECT_EQ(dictionary_segment.lower_bound(4), 2);
+  EXPECT_EQ(dictionary_segment.upper_bound(3), 2);
+  EXPECT_EQ(dictionary_segment.search_index()->estimate_memory_usage(), index_memory_usage);
+  EXPECT_EQ(dictionary_segment.find(3), 1);
+  EXPECT_GE(dictionary_segment.search_index()->estimate_memory_usage(),
+            index_memory_usage + 2 * DictionarySearchIndex<int32_t>::MIN_DICTIONARY_SIZE * sizeof(uint32_t));
+  EXPECT_EQ(dictionary_segment.find(4), INVALID_VALUE_ID);
+  EXPECT_EQ(dictionary_segment.lower_bound(std::vector<int32_t>{-1, 5, 1'000'000}),
+            std::vector<ValueID>({ValueID{0}, ValueID{2}, INVALID_VALUE_ID}));
+
+  const auto small_value_segment = std::make_shared<ValueSegment<int32_t>>();
+  small_value_segment->append(1);
+  small_value_segment->append(5);
+  const auto small_dictionary_segment = DictionarySegment<int32_t>{small_value_segment};
+  EXPECT_FALSE(small_dictionary_segment.search_index());
+  EXPECT_EQ(small_dictionary_segment.find(5), 1);
+  EXPECT_EQ(small_dictionary_segment.find(4), INVALID_VALUE_ID);
+  EXPECT_EQ(small_dictionary_segment.lower_bound(std::vector<int32_t>{2, 6}),
+            std::vector<ValueID>({ValueID{1}, INVALID_VALUE_ID}));
+
+  // Segments that are re-encoded against the same dictionary share its index.
+  const auto reencoded_segment = DictionarySegment<int32_t>{dictionary_segment, dictionary_segment.shared_dictionary()};
+  EXPECT_EQ(reencoded_segment.search_index(), dictionary_segment.search_index());
+}
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_attribute_vector.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/bit_packed_vector.hpp"
 #include "storage/dictionary_segment.hpp"
 
 namespace opossum {
@@ -43,6 +44,74 @@ TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
   EXPECT_THROW(dict_segment->get(6), std::logic_error);
 }
 
+TEST_F(StorageDictionarySegmentTest, CompressSegmentBitPacked) {
+  for (auto value = int32_t{0}; value < 300; ++value) {
+    value_segment_int->append(value % 20);
+  }
+
+  const auto dict_segment =
+      std::make_shared<DictionarySegment<int32_t>>(value_segment_int, VectorCompressionType::BitPacked);
+  const auto attribute_vector = std::dynamic_pointer_cast<const BitPackedVector>(dict_segment->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+
+  // 20 distinct values need 5 bits.
+  EXPECT_EQ(attribute_vector->bit_width(), 5);
+  EXPECT_EQ(dict_segment->unique_values_count(), 20);
+  for (auto index = ChunkOffset{0}; index < 300; ++index) {
+    EXPECT_EQ(dict_segment->get(index), static_cast<int32_t>(index % 20));
+  }
+  EXPECT_EQ(dict_segment->estimate_memory_usage(), 20 * sizeof(int32_t) + 25 * sizeof(uint64_t));
+}
+
+TEST_F(StorageDictionarySegmentTest, CompressNullOnlySegment) {
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append(NULL_VALUE);
+
+  const auto dict_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+  EXPECT_EQ(dict_segment->size(), 2);
+  EXPECT_EQ(dict_segment->unique_values_count(), 0);
+  EXPECT_TRUE(variant_is_null((*dict_segment)[1]));
+}
+
+TEST_F(StorageDictionarySegmentTest, CompressLargeSegment) {
+  // Large enough to be split into three partitions, whose partial dictionaries overlap.
+  const auto row_count = int32_t{600'000};
+  const auto value_at = [](const int32_t index) {
+    return static_cast<int32_t>(int64_t{index} * 7919 % 100'003) - 50'000;
+  };
+  for (auto index = int32_t{0}; index < row_count; ++index) {
+    value_segment_int->append(value_at(index));
+  }
+  for (auto index = int32_t{0}; index < 1000; ++index) {
+    const auto value = std::to_string(index % 30);
+    value_segment_str->append(index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value});
+  }
+
+  const auto dict_segment_int = std::make_shared<DictionarySegment<int32_t>>(value_segment_int);
+  const auto& dict = dict_segment_int->dictionary();
+  EXPECT_EQ(dict.size(), 100'003);
+  EXPECT_TRUE(std::is_sorted(dict.begin(), dict.end()));
+  EXPECT_EQ(dict.front(), -50'000);
+  EXPECT_EQ(dict.back(), 50'002);
+  for (auto index = int32_t{0}; index < row_count; index += 997) {
+    EXPECT_EQ(dict_segment_int->get(index), value_at(index));
+  }
+
+  // Limiting the threads, e.g., when several columns are compressed at once, does not change the result.
+  const auto sequential_segment_int =
+      DictionarySegment<int32_t>{value_segment_int, VectorCompressionType::FixedWidthInteger, 1};
+  EXPECT_EQ(sequential_segment_int.dictionary(), dict);
+  for (auto index = int32_t{0}; index < row_count; index += 997) {
+    EXPECT_EQ(sequential_segment_int.get(index), value_at(index));
+  }
+
+  const auto dict_segment_str = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+  EXPECT_EQ(dict_segment_str->unique_values_count(), 30);
+  for (auto index = ChunkOffset{0}; index < 1000; ++index) {
+    EXPECT_EQ(dict_segment_str->get_typed_value(index), (*value_segment_str).get_typed_value(index));
+  }
+}
+
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   for (auto value = int16_t{0}; value <= 10; value += 2) {
     value_segment_int->append(value);
@@ -99,12 +168,45 @@ TEST_F(StorageDictionarySegmentTest, ValueOfValueID) {
   EXPECT_THROW(dict_segment->value_of_value_id(dict_segment->null_value_id()), std::logic_error);
 }
 
+TEST_F(StorageDictionarySegmentTest, ReencodeWithMergedDictionary) {
+  value_segment_str->append("Hasso");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Bill");
+  const auto dict_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+
+  const auto other_value_segment = std::make_shared<ValueSegment<std::string>>(true);
+  other_value_segment->append("Alexander");
+  other_value_segment->append("Hasso");
+  const auto other_dict_segment = std::make_shared<DictionarySegment<std::string>>(other_value_segment);
+
+  const auto merged_dictionary = DictionarySegment<std::string>::merge_dictionaries(
+      dict_segment->shared_dictionary(), other_dict_segment->dictionary());
+  EXPECT_EQ(merged_dictionary->values(), std::vector<std::string>({"Alexander", "Bill", "Hasso"}));
+  EXPECT_EQ(DictionarySegment<std::string>::merge_dictionaries(merged_dictionary, dict_segment->dictionary()),
+            merged_dictionary);
+
+  const auto reencoded_segment = DictionarySegment<std::string>{*dict_segment, merged_dictionary};
+  EXPECT_TRUE(reencoded_segment.has_shared_dictionary());
+  EXPECT_FALSE(dict_segment->has_shared_dictionary());
+  EXPECT_EQ(reencoded_segment.attribute_vector()->get(0), 3);
+  EXPECT_EQ(reencoded_segment.attribute_vector()->get(1), reencoded_segment.null_value_id());
+  EXPECT_EQ(reencoded_segment.attribute_vector()->get(2), 2);
+  EXPECT_EQ(reencoded_segment[0], AllTypeVariant{"Hasso"});
+  EXPECT_TRUE(variant_is_null(reencoded_segment[1]));
+
+  // A dictionary that lacks values of the segment cannot be used.
+  EXPECT_THROW((DictionarySegment<std::string>{*dict_segment, other_dict_segment->shared_dictionary()}),
+               std::logic_error);
+}
+
 TEST_F(StorageDictionarySegmentTest, MemoryUsageString) {
   value_segment_str->append("Hello");
   const auto column_str = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
   const auto dict_col_str = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(column_str);
 
-  EXPECT_EQ(dict_col_str->estimate_memory_usage(), 1 * sizeof(std::string) + 1 * sizeof(uint8_t));
+  // The front-coded dictionary stores one length byte, the five characters, one block offset, and the block header as
+  // a GermanString.
+  EXPECT_EQ(dict_col_str->estimate_memory_usage(), 6 + sizeof(uint32_t) + sizeof(GermanString) + 1 * sizeof(uint8_t));
 }
 
 TEST_F(StorageDictionarySegmentTest, MemoryUsageUInt8) {
@@ -135,8 +237,11 @@ TEST_F(StorageDictionarySegmentTest, MemoryUsageUInt32) {
   auto column = std::make_shared<DictionarySegment<int32_t>>(value_segment_int);
   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int32_t>>(column);
 
-  EXPECT_EQ(dict_col->estimate_memory_usage(),
-            ((UINT16_MAX + 2)) * sizeof(int32_t) + ((UINT16_MAX + 2)) * sizeof(uint32_t));
+  // The dictionary is large enough to be searched with an additional index.
+  ASSERT_TRUE(dict_col->search_index());
+  EXPECT_EQ(dict_col->estimate_memory_usage(), ((UINT16_MAX + 2)) * sizeof(int32_t) +
+                                                   ((UINT16_MAX + 2)) * sizeof(uint32_t) +
+                                                   dict_col->search_index()->estimate_memory_usage());
 }
 
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "base_test.hpp"
 
+#include "storage/abstract_attribute_vector.hpp"
 #include "storage/fixed_width_integer_vector.hpp"
 
 namespace opossum {
@@ -37,4 +38,26 @@ TEST_F(FixedWidthIntegerVectorTest, BasicOperations) {
   EXPECT_EQ(large_vector->width(), sizeof(uint32_t));
 }
 
+TEST_F(FixedWidthIntegerVectorTest, Decode) {
+  // Enough values for the vectorized loops plus a remainder, decoded from an unaligned begin.
+  const auto size = size_t{100};
+  auto vectors = std::vector<std::shared_ptr<AbstractAttributeVector>>{
+      std::make_shared<FixedWidthIntegerVector<uint8_t>>(size),
+      std::make_shared<FixedWidthIntegerVector<uint16_t>>(size),
+      std::make_shared<FixedWidthIntegerVector<uint32_t>>(size),
+  };
+  for (const auto& vector : vectors) {
+    for (auto index = size_t{0}; index < size; ++index) {
+      vector->set(index, static_cast<ValueID>(255 - index));
+    }
+
+    auto decoded = std::vector<ValueID::base_type>(size - 3);
+    vector->decode(3, size, decoded.data());
+    for (auto index = size_t{3}; index < size; ++index) {
+      EXPECT_EQ(decoded[index - 3], 255 - index);
+    }
+    EXPECT_THROW(vector->decode(3, size + 1, decoded.data()), std::logic_error);
+  }
+}
+
 }  // namespace opossum
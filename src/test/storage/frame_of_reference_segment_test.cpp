@@ -0,0 +1,107 @@
+#include "base_test.hpp"
+
+#include "storage/frame_of_reference_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<int64_t>> value_segment_long{std::make_shared<ValueSegment<int64_t>>()};
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegment) {
+  value_segment_int->append(1000);
+  value_segment_int->append(1003);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(1001);
+
+  const auto segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(segment->size(), 4);
+  EXPECT_FALSE(segment->is_delta_encoded());
+  EXPECT_EQ(segment->block_minima(), std::vector<int32_t>{1000});
+  EXPECT_EQ(segment->block_bit_widths(), std::vector<uint8_t>{2});
+
+  EXPECT_EQ(segment->get(0), 1000);
+  EXPECT_EQ(segment->get(1), 1003);
+  EXPECT_EQ(segment->get_typed_value(2), std::nullopt);
+  EXPECT_EQ(segment->get(3), 1001);
+  EXPECT_TRUE(variant_is_null((*segment)[2]));
+  EXPECT_EQ((*segment)[1], AllTypeVariant{1003});
+  EXPECT_THROW(segment->get(2), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, NegativeAndExtremeValues) {
+  value_segment_long->append(std::numeric_limits<int64_t>::max());
+  value_segment_long->append(std::numeric_limits<int64_t>::min());
+  value_segment_long->append(int64_t{-5});
+
+  const auto segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_long);
+  EXPECT_EQ(segment->block_bit_widths(), std::vector<uint8_t>{64});
+  EXPECT_EQ(segment->get(0), std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(segment->get(1), std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(segment->get(2), -5);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MultipleBlocksAndDecode) {
+  const auto row_count = int64_t{5000};
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    value_segment_long->append(1'600'000'000'000'000 + (index * 7919) % 1000);
+  }
+
+  const auto segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_long);
+  EXPECT_EQ(segment->block_minima().size(), 3);
+
+  auto decoded = std::vector<int64_t>(row_count - 100);
+  segment->decode(100, row_count, decoded.data());
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    const auto expected = 1'600'000'000'000'000 + (index * 7919) % 1000;
+    EXPECT_EQ(segment->get(index), expected);
+    if (index >= 100) {
+      EXPECT_EQ(decoded[index - 100], expected);
+    }
+  }
+
+  // Offsets below 1000 need 10 bits instead of 64.
+  EXPECT_LT(segment->estimate_memory_usage(), value_segment_long->estimate_memory_usage() / 4);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, DeltaEncoding) {
+  const auto row_count = int64_t{3000};
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    value_segment_long->append(1'000'000'000 + index * 3);
+  }
+
+  const auto segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_long, true);
+  EXPECT_TRUE(segment->is_delta_encoded());
+  EXPECT_EQ(segment->block_bit_widths(), (std::vector<uint8_t>{2, 2}));
+
+  auto decoded = std::vector<int64_t>(row_count);
+  segment->decode(0, row_count, decoded.data());
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    EXPECT_EQ(decoded[index], 1'000'000'000 + index * 3);
+  }
+  EXPECT_EQ(segment->get(2500), 1'000'000'000 + 2500 * 3);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, DeltaEncodingWithNulls) {
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(5);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(9);
+
+  const auto segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment_int, true);
+  EXPECT_EQ(segment->get_typed_value(0), std::nullopt);
+  EXPECT_EQ(segment->get(1), 5);
+  EXPECT_EQ(segment->get_typed_value(2), std::nullopt);
+  EXPECT_EQ(segment->get(3), 9);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, DeltaEncodingRequiresSortedValues) {
+  value_segment_int->append(5);
+  value_segment_int->append(4);
+
+  EXPECT_THROW(FrameOfReferenceSegment<int32_t>(value_segment_int, true), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#include "base_test.hpp"
+
+#include "storage/front_coded_dictionary.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 100; ++index) {
+      values.push_back("https://example.com/path/" + std::to_string(1000 + index * 2));
+    }
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageFrontCodedDictionaryTest, AccessValues) {
+  const auto dictionary = FrontCodedDictionary{values};
+  EXPECT_EQ(dictionary.size(), values.size());
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary[index], values[index]);
+  }
+  EXPECT_EQ(dictionary.at(99), values[99]);
+  EXPECT_THROW(dictionary.at(100), std::logic_error);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, LowerUpperBound) {
+  const auto dictionary = FrontCodedDictionary{values};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary.lower_bound(values[index]), index);
+    EXPECT_EQ(dictionary.upper_bound(values[index]), index + 1);
+  }
+
+  // Values between two entries, e.g., ".../1001" between ".../1000" and ".../1002".
+  EXPECT_EQ(dictionary.lower_bound("https://example.com/path/1001"), 1);
+  EXPECT_EQ(dictionary.upper_bound("https://example.com/path/1001"), 1);
+  EXPECT_EQ(dictionary.lower_bound("https://example.com/path/1031"), 16);
+  EXPECT_EQ(dictionary.upper_bound("https://example.com/path/1032"), 17);
+
+  EXPECT_EQ(dictionary.lower_bound("a"), 0);
+  EXPECT_EQ(dictionary.upper_bound(""), 0);
+  EXPECT_EQ(dictionary.lower_bound("z"), values.size());
+  EXPECT_EQ(dictionary.upper_bound(values.back()), values.size());
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, EmptyDictionary) {
+  const auto dictionary = FrontCodedDictionary{std::vector<std::string>{}};
+  EXPECT_EQ(dictionary.size(), 0);
+  EXPECT_EQ(dictionary.lower_bound("a"), 0);
+  EXPECT_EQ(dictionary.upper_bound("a"), 0);
+  EXPECT_EQ(dictionary.estimate_memory_usage(), 0);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, SharedPrefixesReduceMemory) {
+  const auto dictionary = FrontCodedDictionary{values};
+
+  auto plain_size = values.size() * sizeof(std::string);
+  for (const auto& value : values) {
+    plain_size += value.size();
+  }
+  EXPECT_LT(dictionary.estimate_memory_usage() * 3, plain_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#include "base_test.hpp"
+
+#include "storage/fsst_segment.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>(true)};
+};
+
+TEST_F(StorageFSSTSegmentTest, CompressSegment) {
+  value_segment_str->append("Mozilla/5.0 (X11; Linux x86_64)");
+  value_segment_str->append("Mozilla/5.0 (Windows NT 10.0; Win64; x64)");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("");
+  value_segment_str->append("Mozilla/5.0 (X11; Linux x86_64)");
+
+  const auto segment = std::make_shared<FSSTSegment>(value_segment_str);
+  EXPECT_EQ(segment->size(), 5);
+  EXPECT_GT(segment->symbol_count(), 0);
+
+  EXPECT_EQ(segment->get(0), "Mozilla/5.0 (X11; Linux x86_64)");
+  EXPECT_EQ(segment->get(1), "Mozilla/5.0 (Windows NT 10.0; Win64; x64)");
+  EXPECT_EQ(segment->get_typed_value(2), std::nullopt);
+  EXPECT_TRUE(variant_is_null((*segment)[2]));
+  EXPECT_THROW(segment->get(2), std::logic_error);
+  EXPECT_EQ(segment->get(3), "");
+  EXPECT_EQ((*segment)[4], AllTypeVariant{"Mozilla/5.0 (X11; Linux x86_64)"});
+
+  // The estimate includes the lookup table of the codes by their first byte.
+  EXPECT_GE(segment->estimate_memory_usage(),
+            257 + 255 + segment->symbol_count() * (sizeof(uint64_t) + sizeof(uint8_t)));
+}
+
+TEST_F(StorageFSSTSegmentTest, EqualityOnCompressedValues) {
+  value_segment_str->append("GET /index.html");
+  value_segment_str->append("GET /about.html");
+  value_segment_str->append("GET /index.html");
+
+  const auto segment = std::make_shared<FSSTSegment>(value_segment_str);
+  const auto search_value = segment->compress("GET /index.html");
+  EXPECT_EQ(segment->compressed_value(0), search_value);
+  EXPECT_NE(segment->compressed_value(1), search_value);
+  EXPECT_EQ(segment->compressed_value(2), search_value);
+
+  // Values containing bytes that are not part of the symbol table are escaped.
+  const auto unknown_value = segment->compress("\xF0\x9F\x90\x80");
+  EXPECT_EQ(unknown_value.size(), 8);
+  EXPECT_NE(segment->compressed_value(0), unknown_value);
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressesRepetitiveStrings) {
+  auto values = std::vector<std::string>{};
+  auto uncompressed_size = size_t{0};
+  for (auto index = 0; index < 1000; ++index) {
+    const auto value = "2023-06-01 12:00:" + std::to_string(index % 60) + " INFO [worker-" + std::to_string(index % 8) +
+                       "] Finished processing request " + std::to_string(index);
+    uncompressed_size += value.size();
+    values.push_back(value);
+    value_segment_str->append(value);
+  }
+
+  const auto segment = std::make_shared<FSSTSegment>(value_segment_str);
+  for (auto index = ChunkOffset{0}; index < 1000; ++index) {
+    EXPECT_EQ(segment->get(index), values[index]);
+  }
+  EXPECT_LT(segment->estimate_memory_usage() * 3, uncompressed_size * 2);
+}
+
+}  // namespace opossum
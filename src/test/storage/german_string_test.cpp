@@ -0,0 +1,70 @@
+#include <algorithm>
+
+#include "base_test.hpp"
+
+#include "storage/german_string.hpp"
+
+namespace opossum {
+
+class StorageGermanStringTest : public BaseTest {};
+
+TEST_F(StorageGermanStringTest, InlineAndLongValues) {
+  const auto empty = GermanString{};
+  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.view(), "");
+
+  const auto short_value = GermanString{"Hello World!"};
+  EXPECT_TRUE(short_value.is_inlined());
+  EXPECT_EQ(short_value.view(), "Hello World!");
+  EXPECT_EQ(short_value.prefix(), "Hell");
+
+  const auto long_string = std::string{"Hello World, this is long."};
+  const auto long_value = GermanString{long_string};
+  EXPECT_FALSE(long_value.is_inlined());
+  EXPECT_EQ(long_value.view().data(), long_string.data());
+  EXPECT_EQ(std::string{long_value}, long_string);
+
+  const auto tiny_value = GermanString{"ab"};
+  EXPECT_EQ(tiny_value.prefix(), std::string_view("ab\0\0", 4));
+}
+
+TEST_F(StorageGermanStringTest, Comparison) {
+  // Values with equal prefixes, values that are prefixes of others, and values containing zero bytes.
+  const auto strings = std::vector<std::string>{"",
+                                                "a",
+                                                std::string("a\0", 2),
+                                                "ab",
+                                                "abcd",
+                                                "abcdefghijklm",
+                                                "abcdefghijkl",
+                                                "abcdefghijklz",
+                                                "abce",
+                                                "b",
+                                                "\xff"};
+  for (const auto& lhs : strings) {
+    for (const auto& rhs : strings) {
+      const auto lhs_value = GermanString{lhs};
+      const auto rhs_value = GermanString{rhs};
+      EXPECT_EQ(lhs_value == rhs_value, lhs == rhs) << lhs << " vs. " << rhs;
+      EXPECT_EQ(lhs_value < rhs_value, lhs < rhs) << lhs << " vs. " << rhs;
+      EXPECT_EQ(lhs_value > rhs_value, lhs > rhs) << lhs << " vs. " << rhs;
+    }
+  }
+
+  // Equal long values are found equal even if they are stored at different addresses.
+  const auto first_copy = std::string{"a long value of many characters"};
+  const auto second_copy = first_copy;
+  EXPECT_EQ(GermanString{first_copy}, GermanString{second_copy});
+}
+
+TEST_F(StorageGermanStringTest, Sort) {
+  auto strings = std::vector<std::string>{"pear", "apple pie with cream", "apple", "apple pie", "banana", ""};
+  auto values = std::vector<GermanString>(strings.begin(), strings.end());
+  std::sort(strings.begin(), strings.end());
+  std::sort(values.begin(), values.end());
+  for (auto index = size_t{0}; index < strings.size(); ++index) {
+    EXPECT_EQ(values[index].view(), strings[index]);
+  }
+}
+
+}  // namespace opossum
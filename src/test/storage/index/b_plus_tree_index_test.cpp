@@ -0,0 +1,107 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/b_plus_tree_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBPlusTreeIndexTest : public BaseTest {
+ protected:
+  // Returns the chunk offsets of the matches, sorted.
+  template <typename T>
+  static std::vector<ChunkOffset> lookup(const BPlusTreeIndex<T>& index, const ScanType scan_type, const T& value) {
+    auto matches = PosList{};
+    index.append_matches(scan_type, value, ChunkID{0}, matches);
+    auto rows = std::vector<ChunkOffset>{};
+    for (const auto& row_id : matches) {
+      rows.push_back(row_id.chunk_offset);
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  // Returns the chunk offsets of the rows that satisfy the predicate, found by comparing each value.
+  static std::vector<ChunkOffset> scan(const std::vector<int32_t>& values, const ScanType scan_type,
+                                       const int32_t search_value) {
+    auto rows = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      const auto value = values[chunk_offset];
+      const auto matches = (scan_type == ScanType::OpEquals && value == search_value) ||
+                           (scan_type == ScanType::OpNotEquals && value != search_value) ||
+                           (scan_type == ScanType::OpLessThan && value < search_value) ||
+                           (scan_type == ScanType::OpLessThanEquals && value <= search_value) ||
+                           (scan_type == ScanType::OpGreaterThan && value > search_value) ||
+                           (scan_type == ScanType::OpGreaterThanEquals && value >= search_value);
+      if (matches) {
+        rows.push_back(chunk_offset);
+      }
+    }
+    return rows;
+  }
+};
+
+TEST_F(StorageBPlusTreeIndexTest, MaintainedOnInsert) {
+  // Enough rows for three levels, inserted in an order that splits leaves everywhere, with many duplicates.
+  auto values = std::vector<int32_t>{};
+  auto segment = ValueSegment<int32_t>{};
+  auto index = BPlusTreeIndex<int32_t>{segment};
+  for (auto row = int32_t{0}; row < 10'000; ++row) {
+    const auto value = (row * 7'919) % 1'000;
+    values.push_back(value);
+    index.insert(value, static_cast<ChunkOffset>(row));
+  }
+  index.insert(NULL_VALUE, ChunkOffset{10'000});
+  EXPECT_EQ(index.size(), 10'000);
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto value : {-1, 0, 1, 499, 500, 998, 999, 1'000}) {
+      EXPECT_EQ(lookup(index, scan_type, value), scan(values, scan_type, value));
+    }
+  }
+
+  // The rows of a value are in the order in which they were inserted.
+  auto matches = PosList{};
+  index.append_matches(ScanType::OpEquals, 3, ChunkID{4}, matches);
+  ASSERT_EQ(matches.size(), 10);
+  EXPECT_TRUE(std::is_sorted(matches.begin(), matches.end()));
+  EXPECT_EQ(matches.front().chunk_id, ChunkID{4});
+
+  matches.clear();
+  index.append_range_matches(10, 19, ChunkID{0}, matches);
+  EXPECT_EQ(matches.size(), 100);
+  index.append_range_matches(19, 10, ChunkID{0}, matches);
+  EXPECT_EQ(matches.size(), 100);
+  index.append_matches(ScanType::OpEquals, NULL_VALUE, ChunkID{0}, matches);
+  EXPECT_EQ(matches.size(), 100);
+}
+
+TEST_F(StorageBPlusTreeIndexTest, BuiltFromSegment) {
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+  for (auto row = 0; row < 1'000; ++row) {
+    value_segment->append(row % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{std::to_string(row % 100)});
+  }
+
+  // The index is the same for any encoding of the segment.
+  for (const auto& segment : std::vector<std::shared_ptr<AbstractSegment>>{
+           value_segment, std::make_shared<DictionarySegment<std::string>>(value_segment)}) {
+    auto index = BPlusTreeIndex<std::string>{*segment};
+    EXPECT_EQ(index.size(), 900);
+    EXPECT_EQ(lookup<std::string>(index, ScanType::OpEquals, "42").size(), 10);
+    EXPECT_EQ(lookup<std::string>(index, ScanType::OpEquals, "40").size(), 0);
+    EXPECT_EQ(lookup<std::string>(index, ScanType::OpLessThan, "2").size(), 100);
+
+    // Rows inserted after bulk loading end up between the loaded ones.
+    index.insert_typed("42", ChunkOffset{1'000});
+    EXPECT_EQ(lookup<std::string>(index, ScanType::OpEquals, "42").back(), 1'000);
+    EXPECT_EQ(lookup<std::string>(index, ScanType::OpGreaterThanEquals, "42").size(), 58 * 10 + 1);
+  }
+
+  const auto empty_index = BPlusTreeIndex<std::string>{ValueSegment<std::string>{}};
+  EXPECT_EQ(empty_index.size(), 0);
+  EXPECT_TRUE(lookup<std::string>(empty_index, ScanType::OpNotEquals, "a").empty());
+  EXPECT_GT(empty_index.estimate_memory_usage(), 0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/cracking_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageCrackingIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto row = int32_t{0}; row < 1'000; ++row) {
+      const auto value = (row * 7'919) % 100;
+      values.push_back(value);
+      value_segment->append(row % 50 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value});
+    }
+  }
+
+  // Returns the chunk offsets of the matches, sorted.
+  static std::vector<ChunkOffset> sorted_chunk_offsets(const PosList& matches) {
+    auto rows = std::vector<ChunkOffset>{};
+    for (const auto& row_id : matches) {
+      rows.push_back(row_id.chunk_offset);
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  // Returns the chunk offsets of the rows other than NULL whose values are in [min, max].
+  std::vector<ChunkOffset> scan(const int32_t min, const int32_t max) const {
+    auto rows = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      if (chunk_offset % 50 != 0 && values[chunk_offset] >= min && values[chunk_offset] <= max) {
+        rows.push_back(chunk_offset);
+      }
+    }
+    return rows;
+  }
+
+  std::vector<int32_t> values;
+  std::shared_ptr<ValueSegment<int32_t>> value_segment{std::make_shared<ValueSegment<int32_t>>(true)};
+};
+
+TEST_F(StorageCrackingIndexTest, CracksOnQueries) {
+  const auto index = CrackingIndex<int32_t>{value_segment};
+  EXPECT_EQ(index.crack_count(), 0);
+
+  // Every query is answered correctly, no matter which cracks earlier queries left behind.
+  const auto ranges = std::vector<std::pair<int32_t, int32_t>>{{20, 40}, {30, 35}, {-5, 20}, {35, 120}, {30, 35},
+                                                               {0, 0},   {99, 99}, {50, 49}, {41, 41}};
+  for (const auto& [min, max] : ranges) {
+    auto matches = PosList{};
+    index.append_range_matches(min, max, ChunkID{3}, matches);
+    EXPECT_EQ(sorted_chunk_offsets(matches), scan(min, max));
+  }
+  // The repeated query did not add cracks, and the empty range is not cracked at all.
+  EXPECT_EQ(index.crack_count(), 14);
+
+  const auto lookup = [&](const ScanType scan_type, const int32_t value) {
+    auto matches = PosList{};
+    index.append_matches(scan_type, value, ChunkID{3}, matches);
+    return sorted_chunk_offsets(matches);
+  };
+  EXPECT_EQ(lookup(ScanType::OpEquals, 30), scan(30, 30));
+  EXPECT_EQ(lookup(ScanType::OpLessThan, 30), scan(0, 29));
+  EXPECT_EQ(lookup(ScanType::OpLessThanEquals, 30), scan(0, 30));
+  EXPECT_EQ(lookup(ScanType::OpGreaterThan, 30), scan(31, 99));
+  EXPECT_EQ(lookup(ScanType::OpGreaterThanEquals, 30), scan(30, 99));
+  auto not_equals = scan(0, 29);
+  const auto greater_than = scan(31, 99);
+  not_equals.insert(not_equals.end(), greater_than.begin(), greater_than.end());
+  std::sort(not_equals.begin(), not_equals.end());
+  EXPECT_EQ(lookup(ScanType::OpNotEquals, 30), not_equals);
+  EXPECT_TRUE(lookup(ScanType::OpEquals, 100).empty());
+
+  auto matches = PosList{};
+  index.append_matches(ScanType::OpNotEquals, NULL_VALUE, ChunkID{3}, matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(StorageCrackingIndexTest, EncodedSegment) {
+  const auto index = CrackingIndex<int32_t>{std::make_shared<DictionarySegment<int32_t>>(value_segment)};
+  auto matches = PosList{};
+  index.append_range_matches(10, 19, ChunkID{0}, matches);
+  EXPECT_EQ(sorted_chunk_offsets(matches), scan(10, 19));
+  EXPECT_GE(index.estimate_memory_usage(), 980 * (sizeof(int32_t) + sizeof(ChunkOffset)));
+}
+
+}  // namespace opossum
@@ -0,0 +1,128 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {7, 3, 5, 3, 9, 7, 3, 1}) {
+      value_segment_int->append(value);
+      nullable_value_segment_int->append(value);
+    }
+    nullable_value_segment_int->append(NULL_VALUE);
+    nullable_value_segment_int->append(5);
+    nullable_value_segment_int->append(NULL_VALUE);
+
+    dictionary_segment_int = std::make_shared<DictionarySegment<int32_t>>(value_segment_int);
+    nullable_dictionary_segment_int = std::make_shared<DictionarySegment<int32_t>>(nullable_value_segment_int);
+  }
+
+  // Returns the rows of a segment that satisfy the predicate, found by comparing each value.
+  static std::vector<ChunkOffset> scan(const AbstractSegment& segment, const ScanType scan_type, const int32_t value) {
+    auto rows = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      const auto variant = segment[chunk_offset];
+      if (variant_is_null(variant)) {
+        continue;
+      }
+      const auto row_value = type_cast<int32_t>(variant);
+      auto matches = false;
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          matches = row_value == value;
+          break;
+        case ScanType::OpNotEquals:
+          matches = row_value != value;
+          break;
+        case ScanType::OpLessThan:
+          matches = row_value < value;
+          break;
+        case ScanType::OpLessThanEquals:
+          matches = row_value <= value;
+          break;
+        case ScanType::OpGreaterThan:
+          matches = row_value > value;
+          break;
+        case ScanType::OpGreaterThanEquals:
+          matches = row_value >= value;
+          break;
+      }
+      if (matches) {
+        rows.push_back(chunk_offset);
+      }
+    }
+    return rows;
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>()};
+  std::shared_ptr<ValueSegment<int32_t>> nullable_value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<DictionarySegment<int32_t>> dictionary_segment_int;
+  std::shared_ptr<DictionarySegment<int32_t>> nullable_dictionary_segment_int;
+};
+
+TEST_F(StorageGroupKeyIndexTest, GroupsRowsByValue) {
+  const auto index = GroupKeyIndex<int32_t>{nullable_dictionary_segment_int};
+  // NULL rows are not indexed.
+  EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()),
+            std::vector<ChunkOffset>({7, 1, 3, 6, 2, 9, 0, 5, 4}));
+  EXPECT_EQ(std::vector<ChunkOffset>(index.lower_bound(3), index.upper_bound(5)),
+            std::vector<ChunkOffset>({1, 3, 6, 2, 9}));
+  EXPECT_EQ(index.lower_bound(4), index.upper_bound(3));
+  EXPECT_EQ(index.lower_bound(0), index.cbegin());
+  EXPECT_EQ(index.lower_bound(10), index.cend());
+  EXPECT_EQ(index.upper_bound(9), index.cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, AppendMatches) {
+  for (const auto& segment : {dictionary_segment_int, nullable_dictionary_segment_int}) {
+    const auto index = GroupKeyIndex<int32_t>{segment};
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+      for (auto value = int32_t{0}; value <= 10; ++value) {
+        auto matches = PosList{};
+        index.append_matches(scan_type, value, ChunkID{2}, matches);
+        auto rows = std::vector<ChunkOffset>{};
+        for (const auto& row_id : matches) {
+          EXPECT_EQ(row_id.chunk_id, ChunkID{2});
+          rows.push_back(row_id.chunk_offset);
+        }
+        std::sort(rows.begin(), rows.end());
+        EXPECT_EQ(rows, scan(*segment, scan_type, value));
+      }
+    }
+  }
+
+  // Matches are appended, and a NULL search value matches nothing.
+  const auto index = GroupKeyIndex<int32_t>{nullable_dictionary_segment_int};
+  auto matches = PosList{RowID{ChunkID{0}, ChunkOffset{0}}};
+  index.append_matches(ScanType::OpEquals, 3, ChunkID{1}, matches);
+  EXPECT_EQ(matches.size(), 4);
+  index.append_matches(ScanType::OpNotEquals, NULL_VALUE, ChunkID{1}, matches);
+  EXPECT_EQ(matches.size(), 4);
+}
+
+TEST_F(StorageGroupKeyIndexTest, SharedDictionary) {
+  // The dictionary may contain values that the segment does not, which have no rows.
+  const auto merged_dictionary = DictionarySegment<int32_t>::merge_dictionaries(
+      nullable_dictionary_segment_int->shared_dictionary(), std::vector<int32_t>{2, 4, 11});
+  const auto segment =
+      std::make_shared<DictionarySegment<int32_t>>(*nullable_dictionary_segment_int, merged_dictionary);
+  const auto index = GroupKeyIndex<int32_t>{segment};
+  EXPECT_EQ(index.lower_bound(2), index.upper_bound(2));
+  EXPECT_EQ(index.lower_bound(11), index.cend());
+  auto matches = PosList{};
+  index.append_matches(ScanType::OpGreaterThan, 4, ChunkID{0}, matches);
+  EXPECT_EQ(matches.size(), 5);
+}
+
+TEST_F(StorageGroupKeyIndexTest, MemoryUsage) {
+  const auto index = GroupKeyIndex<int32_t>{nullable_dictionary_segment_int};
+  // One offset per dictionary value plus one, and one posting per value other than NULL.
+  EXPECT_GE(index.estimate_memory_usage(), sizeof(index) + (5 + 9) * sizeof(ChunkOffset));
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/imprint_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageImprintIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The values rise slowly, like those of a clustered column, with some noise and a few NULLs.
+    for (auto row = int32_t{0}; row < 10'000; ++row) {
+      const auto value = row / 10 + (row * 7'919) % 7;
+      values.push_back(value);
+      value_segment->append(row % 97 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value});
+    }
+  }
+
+  // Returns the chunk offsets of the matches, sorted.
+  static std::vector<ChunkOffset> sorted_chunk_offsets(const PosList& matches) {
+    auto rows = std::vector<ChunkOffset>{};
+    for (const auto& row_id : matches) {
+      rows.push_back(row_id.chunk_offset);
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  // Returns the chunk offsets of the rows other than NULL whose values satisfy the predicate.
+  template <typename Predicate>
+  std::vector<ChunkOffset> scan(const Predicate& predicate) const {
+    auto rows = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      if (chunk_offset % 97 != 0 && predicate(values[chunk_offset])) {
+        rows.push_back(chunk_offset);
+      }
+    }
+    return rows;
+  }
+
+  std::vector<int32_t> values;
+  std::shared_ptr<ValueSegment<int32_t>> value_segment{std::make_shared<ValueSegment<int32_t>>(true)};
+};
+
+TEST_F(StorageImprintIndexTest, AppendMatches) {
+  for (const auto& segment : std::vector<std::shared_ptr<AbstractSegment>>{
+           value_segment, std::make_shared<DictionarySegment<int32_t>>(value_segment)}) {
+    const auto index = ImprintIndex<int32_t>{segment};
+    EXPECT_EQ(index.bin_count(), ImprintIndex<int32_t>::MAX_BIN_COUNT);
+
+    const auto lookup = [&](const ScanType scan_type, const int32_t value) {
+      auto matches = PosList{};
+      index.append_matches(scan_type, value, ChunkID{0}, matches);
+      return sorted_chunk_offsets(matches);
+    };
+    for (const auto value : {-1, 0, 3, 500, 501, 1'004, 1'005, 1'006}) {
+      EXPECT_EQ(lookup(ScanType::OpEquals, value), scan([&](const auto row_value) { return row_value == value; }));
+      EXPECT_EQ(lookup(ScanType::OpNotEquals, value), scan([&](const auto row_value) { return row_value != value; }));
+      EXPECT_EQ(lookup(ScanType::OpLessThan, value), scan([&](const auto row_value) { return row_value < value; }));
+      EXPECT_EQ(lookup(ScanType::OpLessThanEquals, value),
+                scan([&](const auto row_value) { return row_value <= value; }));
+      EXPECT_EQ(lookup(ScanType::OpGreaterThan, value), scan([&](const auto row_value) { return row_value > value; }));
+      EXPECT_EQ(lookup(ScanType::OpGreaterThanEquals, value),
+                scan([&](const auto row_value) { return row_value >= value; }));
+    }
+
+    auto matches = PosList{};
+    index.append_range_matches(200, 300, ChunkID{0}, matches);
+    EXPECT_EQ(sorted_chunk_offsets(matches),
+              scan([&](const auto row_value) { return row_value >= 200 && row_value <= 300; }));
+    index.append_range_matches(300, 200, ChunkID{0}, matches);
+    index.append_matches(ScanType::OpNotEquals, NULL_VALUE, ChunkID{0}, matches);
+    EXPECT_EQ(sorted_chunk_offsets(matches),
+              scan([&](const auto row_value) { return row_value >= 200 && row_value <= 300; }));
+  }
+}
+
+TEST_F(StorageImprintIndexTest, Lines) {
+  // A line holds 64 bytes of values, or of value ids for DictionarySegments.
+  EXPECT_EQ(ImprintIndex<int32_t>{value_segment}.rows_per_line(), 16);
+  EXPECT_EQ(ImprintIndex<int32_t>{std::make_shared<DictionarySegment<int32_t>>(value_segment)}.rows_per_line(), 32);
+
+  // In a column with few distinct values, each value has a bin of its own. Lines with equal imprints are stored once.
+  const auto constant_segment = std::make_shared<ValueSegment<double>>(std::vector<double>(10'000, 2.5));
+  const auto constant_index = ImprintIndex<double>{constant_segment};
+  EXPECT_EQ(constant_index.bin_count(), 1);
+  EXPECT_LT(constant_index.estimate_memory_usage(), 100 * sizeof(uint64_t));
+  auto matches = PosList{};
+  constant_index.append_matches(ScanType::OpGreaterThan, 2.0, ChunkID{0}, matches);
+  EXPECT_EQ(matches.size(), 10'000);
+
+  // Without repeated imprints, each of the 625 lines costs at most one imprint and one run header.
+  const auto index = ImprintIndex<int32_t>{value_segment};
+  EXPECT_LE(index.estimate_memory_usage(),
+            sizeof(index) + 64 * sizeof(int32_t) + 625 * (sizeof(uint64_t) + sizeof(uint32_t)));
+
+  // In a clustered column, each value fills many lines, whose equal imprints are stored once. The index then costs a
+  // few percent of the values.
+  auto clustered_values = std::vector<int32_t>(100'000);
+  for (auto row = size_t{0}; row < clustered_values.size(); ++row) {
+    clustered_values[row] = static_cast<int32_t>(row / 500);
+  }
+  const auto clustered_segment = std::make_shared<ValueSegment<int32_t>>(std::move(clustered_values));
+  const auto clustered_index = ImprintIndex<int32_t>{clustered_segment};
+  EXPECT_LT(clustered_index.estimate_memory_usage(), clustered_segment->size() * sizeof(int32_t) * 3 / 100);
+  matches.clear();
+  clustered_index.append_range_matches(10, 19, ChunkID{0}, matches);
+  EXPECT_EQ(matches.size(), 5'000);
+}
+
+}  // namespace opossum
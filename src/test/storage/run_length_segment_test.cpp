@@ -0,0 +1,65 @@
+#include "base_test.hpp"
+
+#include "storage/run_length_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>()};
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  for (const auto* value : {"Alpha", "Alpha", "Alpha", "Beta", "Alpha", "Alpha"}) {
+    value_segment_str->append(value);
+  }
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<std::string>>(value_segment_str);
+  EXPECT_EQ(rle_segment->size(), 6);
+  EXPECT_EQ(rle_segment->run_count(), 3);
+  EXPECT_EQ(rle_segment->values(), (std::vector<std::string>{"Alpha", "Beta", "Alpha"}));
+  EXPECT_EQ(rle_segment->end_positions(), (std::vector<ChunkOffset>{2, 3, 5}));
+
+  EXPECT_EQ(rle_segment->get(0), "Alpha");
+  EXPECT_EQ(rle_segment->get(3), "Beta");
+  EXPECT_EQ(rle_segment->get(4), "Alpha");
+  EXPECT_EQ((*rle_segment)[5], AllTypeVariant{"Alpha"});
+}
+
+TEST_F(StorageRunLengthSegmentTest, NullRuns) {
+  value_segment_int->append(4);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(0);
+  value_segment_int->append(0);
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(rle_segment->run_count(), 3);
+  EXPECT_EQ(rle_segment->null_values(), (std::vector<bool>{false, true, false}));
+
+  EXPECT_EQ(rle_segment->get_typed_value(0), 4);
+  EXPECT_EQ(rle_segment->get_typed_value(1), std::nullopt);
+  EXPECT_EQ(rle_segment->get_typed_value(2), std::nullopt);
+  EXPECT_EQ(rle_segment->get_typed_value(3), 0);
+  EXPECT_TRUE(variant_is_null((*rle_segment)[2]));
+  EXPECT_THROW(rle_segment->get(1), std::logic_error);
+  EXPECT_THROW(rle_segment->get_typed_value(5), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(rle_segment->size(), 0);
+  EXPECT_EQ(rle_segment->run_count(), 0);
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryUsage) {
+  for (auto index = int32_t{0}; index < 1000; ++index) {
+    value_segment_int->append(index / 500);
+  }
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(rle_segment->estimate_memory_usage(), 2 * sizeof(int32_t) + 2 * sizeof(ChunkOffset) + 1);
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include "base_test.hpp"
+
+#include <sstream>
+
+#include "storage/encoding_advisor.hpp"
+#include "storage/segment_encoding.hpp"
+
+namespace opossum {
+
+class StorageSegmentEncodingTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<double>> value_segment_double{std::make_shared<ValueSegment<double>>()};
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>()};
+};
+
+TEST_F(StorageSegmentEncodingTest, EncodeSegment) {
+  value_segment_int->append(4);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(2);
+
+  const auto specs = std::vector<SegmentEncodingSpec>{
+      {EncodingType::Unencoded},
+      {EncodingType::Dictionary},
+      {EncodingType::Dictionary, VectorCompressionType::BitPacked},
+      {EncodingType::RunLength},
+      {EncodingType::FrameOfReference},
+  };
+  for (const auto& spec : specs) {
+    const auto segment = encode_segment(value_segment_int, DataType::Int, spec);
+    EXPECT_EQ(get_segment_encoding_spec(segment), spec);
+    EXPECT_EQ((*segment)[0], AllTypeVariant{4});
+    EXPECT_TRUE(variant_is_null((*segment)[1]));
+    EXPECT_EQ((*segment)[2], AllTypeVariant{2});
+  }
+
+  EXPECT_THROW(encode_segment(value_segment_int, DataType::Int, {EncodingType::FSST}), std::logic_error);
+  EXPECT_THROW(encode_segment(value_segment_int, DataType::Int, {EncodingType::ALP}), std::logic_error);
+  EXPECT_THROW(get_segment_encoding_spec(nullptr), std::logic_error);
+}
+
+TEST_F(StorageSegmentEncodingTest, SupportedDataTypes) {
+  EXPECT_TRUE(encoding_supports_data_type(EncodingType::Dictionary, DataType::String));
+  EXPECT_TRUE(encoding_supports_data_type(EncodingType::FrameOfReference, DataType::Long));
+  EXPECT_FALSE(encoding_supports_data_type(EncodingType::FrameOfReference, DataType::Double));
+  EXPECT_TRUE(encoding_supports_data_type(EncodingType::ALP, DataType::Float));
+  EXPECT_FALSE(encoding_supports_data_type(EncodingType::FSST, DataType::Int));
+}
+
+TEST_F(StorageSegmentEncodingTest, PrintSpec) {
+  auto stream = std::stringstream{};
+  stream << SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacked} << ", "
+         << SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedWidthInteger, true};
+  EXPECT_EQ(stream.str(), "Dictionary (BitPacked), FrameOfReference (Delta)");
+}
+
+TEST_F(StorageSegmentEncodingTest, AdvisorChoosesDictionaryForFewDistinctValues) {
+  for (auto index = 0; index < 10'000; ++index) {
+    value_segment_str->append(std::string{"category_"} + std::to_string(index * 7 % 10));
+  }
+
+  const auto spec = choose_segment_encoding(value_segment_str, DataType::String);
+  EXPECT_EQ(spec, (SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacked}));
+}
+
+TEST_F(StorageSegmentEncodingTest, AdvisorChoosesRunLengthForLongRuns) {
+  for (auto index = 0; index < 10'000; ++index) {
+    value_segment_int->append(index % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index / 1000 * 17 % 5});
+  }
+  EXPECT_NE(choose_segment_encoding(value_segment_int, DataType::Int).encoding_type, EncodingType::RunLength);
+
+  auto segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto index = 0; index < 10'000; ++index) {
+    segment->append(index / 500 % 7);
+  }
+  EXPECT_EQ(choose_segment_encoding(segment, DataType::Int), SegmentEncodingSpec{EncodingType::RunLength});
+}
+
+TEST_F(StorageSegmentEncodingTest, AdvisorChoosesFrameOfReferenceForNarrowRanges) {
+  auto segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto index = 0; index < 10'000; ++index) {
+    segment->append(1'000'000 + index * 7919 % 10'000);
+  }
+  EXPECT_EQ(choose_segment_encoding(segment, DataType::Int), SegmentEncodingSpec{EncodingType::FrameOfReference});
+
+  auto sorted_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto index = 0; index < 10'000; ++index) {
+    sorted_segment->append(index * 1000 + index % 7);
+  }
+  EXPECT_EQ(choose_segment_encoding(sorted_segment, DataType::Int),
+            (SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedWidthInteger, true}));
+}
+
+TEST_F(StorageSegmentEncodingTest, AdvisorChoosesALPForDecimals) {
+  for (auto index = 0; index < 10'000; ++index) {
+    value_segment_double->append(static_cast<double>(index * 7919 % 100'000) / 100);
+  }
+  EXPECT_EQ(choose_segment_encoding(value_segment_double, DataType::Double), SegmentEncodingSpec{EncodingType::ALP});
+}
+
+TEST_F(StorageSegmentEncodingTest, AdvisorChoosesUnencodedForIncompressibleValues) {
+  auto segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto index = int64_t{0}; index < 10'000; ++index) {
+    segment->append(static_cast<int64_t>(index * 0x9E3779B97F4A7C15));
+  }
+  EXPECT_EQ(choose_segment_encoding(segment, DataType::Long), SegmentEncodingSpec{EncodingType::Unencoded});
+
+  EXPECT_THROW(choose_segment_encoding(encode_segment(segment, DataType::Long, {}), DataType::Long), std::logic_error);
+}
+
+}  // namespace opossum
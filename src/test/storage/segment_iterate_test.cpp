@@ -0,0 +1,149 @@
+#include "base_test.hpp"
+
+#include "storage/reference_segment.hpp"
+#include "storage/segment_encoding.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Enough rows for several blocks of bulk-decoded segments, with runs for the RunLengthSegment.
+    for (auto index = int32_t{0}; index < 3000; ++index) {
+      if (index % 7 == 3) {
+        value_segment_int->append(NULL_VALUE);
+        value_segment_str->append(NULL_VALUE);
+      } else {
+        value_segment_int->append(index / 4);
+        value_segment_str->append("value_" + std::to_string(index / 4 % 50));
+      }
+    }
+  }
+
+  // Checks that segment_iterate passes the same rows as operator[].
+  template <typename T>
+  void expect_matches_operator(const AbstractSegment& segment) {
+    auto expected_offset = ChunkOffset{0};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset, expected_offset);
+      const auto expected_value = segment[expected_offset];
+      EXPECT_EQ(position.is_null, variant_is_null(expected_value));
+      if (!position.is_null) {
+        EXPECT_EQ(T{position.value}, type_cast<T>(expected_value));
+      }
+      ++expected_offset;
+    });
+    EXPECT_EQ(expected_offset, segment.size());
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>(true)};
+};
+
+TEST_F(StorageSegmentIterateTest, IterateEncodedSegments) {
+  const auto specs = std::vector<SegmentEncodingSpec>{
+      {EncodingType::Unencoded},
+      {EncodingType::Dictionary},
+      {EncodingType::Dictionary, VectorCompressionType::BitPacked},
+      {EncodingType::RunLength},
+  };
+  for (const auto& spec : specs) {
+    expect_matches_operator<int32_t>(*encode_segment(value_segment_int, DataType::Int, spec));
+    expect_matches_operator<std::string>(*encode_segment(value_segment_str, DataType::String, spec));
+  }
+
+  expect_matches_operator<int32_t>(*encode_segment(value_segment_int, DataType::Int, {EncodingType::FrameOfReference}));
+  expect_matches_operator<std::string>(*encode_segment(value_segment_str, DataType::String, {EncodingType::FSST}));
+
+  const auto value_segment_double = std::make_shared<ValueSegment<double>>(std::vector<double>{1.5, -0.25, 3.0});
+  expect_matches_operator<double>(*encode_segment(value_segment_double, DataType::Double, {EncodingType::ALP}));
+}
+
+TEST_F(StorageSegmentIterateTest, IterateReferenceSegment) {
+  const auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int", true);
+  table->add_column("b", "string", false);
+  table->append({1, "one"});
+  table->append({NULL_VALUE, "two"});
+  table->append({3, "three"});
+  table->compress_chunk(ChunkID{0});
+
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      NULL_ROW_ID, RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}, NULL_ROW_ID, RowID{ChunkID{0}, 0}});
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    const auto reference_segment = ReferenceSegment{table, column_id, pos_list};
+    if (column_id == ColumnID{0}) {
+      expect_matches_operator<int32_t>(reference_segment);
+    } else {
+      expect_matches_operator<std::string>(reference_segment);
+    }
+  }
+
+  auto values = std::vector<std::string>{};
+  segment_iterate<std::string>(ReferenceSegment{table, ColumnID{1}, pos_list}, [&](const auto& position) {
+    values.emplace_back(position.is_null ? "NULL" : position.value);
+  });
+  EXPECT_EQ(values, std::vector<std::string>({"NULL", "three", "two", "NULL", "one"}));
+}
+
+TEST_F(StorageSegmentIterateTest, UnknownSegmentType) {
+  EXPECT_THROW(segment_iterate<int64_t>(*value_segment_int, [](const auto&) {}), std::logic_error);
+}
+
+TEST_F(StorageSegmentIterateTest, MaterializeRange) {
+  const auto expect_range_matches_operator = [](const auto& segment, const auto begin, const auto end, auto out) {
+    using T = typename decltype(out)::value_type;
+    out.resize(end - begin);
+    auto nulls = ValidityBitmap{};
+    materialize_range<T>(segment, begin, end, out.data(), &nulls);
+    ASSERT_EQ(nulls.size(), end - begin);
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      const auto expected_value = segment[chunk_offset];
+      EXPECT_EQ(nulls.is_null(chunk_offset - begin), variant_is_null(expected_value));
+      if (!variant_is_null(expected_value)) {
+        EXPECT_EQ(out[chunk_offset - begin], type_cast<T>(expected_value));
+      }
+    }
+  };
+
+  const auto specs = std::vector<SegmentEncodingSpec>{
+      {EncodingType::Unencoded},
+      {EncodingType::Dictionary},
+      {EncodingType::Dictionary, VectorCompressionType::BitPacked},
+      {EncodingType::RunLength},
+  };
+  for (const auto& spec : specs) {
+    const auto segment_int = encode_segment(value_segment_int, DataType::Int, spec);
+    const auto segment_str = encode_segment(value_segment_str, DataType::String, spec);
+    // The ranges cover several batches, a part of a single run, and nothing.
+    for (const auto& [begin, end] : std::vector<std::pair<ChunkOffset, ChunkOffset>>{{0, 3000}, {5, 7}, {9, 9}}) {
+      expect_range_matches_operator(*segment_int, begin, end, std::vector<int32_t>{});
+      expect_range_matches_operator(*segment_str, begin, end, std::vector<std::string>{});
+    }
+  }
+
+  const auto segment_int = encode_segment(value_segment_int, DataType::Int, {EncodingType::FrameOfReference});
+  expect_range_matches_operator(*segment_int, ChunkOffset{1000}, ChunkOffset{2100}, std::vector<int32_t>{});
+  const auto segment_str = encode_segment(value_segment_str, DataType::String, {EncodingType::FSST});
+  expect_range_matches_operator(*segment_str, ChunkOffset{10}, ChunkOffset{20}, std::vector<std::string>{});
+
+  // Without a bitmap for the NULLs, only the values are written.
+  auto values = std::vector<int32_t>(4);
+  materialize_range<int32_t>(*value_segment_int, ChunkOffset{0}, ChunkOffset{4}, values.data(), nullptr);
+  EXPECT_EQ(values, std::vector<int32_t>({0, 0, 0, 0}));
+
+  const auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int", true);
+  table->append({1});
+  table->append({NULL_VALUE});
+  table->append({3});
+  const auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>{RowID{ChunkID{1}, 0}, NULL_ROW_ID, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  expect_range_matches_operator(reference_segment, ChunkOffset{0}, ChunkOffset{4}, std::vector<int32_t>{});
+  expect_range_matches_operator(reference_segment, ChunkOffset{1}, ChunkOffset{3}, std::vector<int32_t>{});
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include "base_test.hpp"
+
+#include "storage/segment_encoding.hpp"
+#include "storage/sorted_segment_search.hpp"
+
+namespace opossum {
+
+class StorageSortedSegmentSearchTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two NULLs, followed by 0, 0, 0, 1, 1, 1, ..., 9, 9, 9 in ascending or descending order.
+    for (const auto& segment : {ascending_segment, descending_segment}) {
+      segment->append(NULL_VALUE);
+      segment->append(NULL_VALUE);
+    }
+    for (auto index = int32_t{0}; index < 30; ++index) {
+      ascending_segment->append(index / 3);
+      descending_segment->append(9 - index / 3);
+    }
+  }
+
+  // Returns the rows that sorted_segment_search finds.
+  static std::vector<ChunkOffset> search(const AbstractSegment& segment, const SortMode sort_mode,
+                                         const ScanType scan_type, const int32_t search_value) {
+    auto matches = std::vector<ChunkOffset>{};
+    sorted_segment_search<int32_t>(segment, sort_mode, scan_type, search_value, [&](const auto begin, const auto end) {
+      EXPECT_LT(begin, end);
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+        matches.push_back(chunk_offset);
+      }
+    });
+    return matches;
+  }
+
+  // Returns the rows that satisfy the predicate by comparing each row.
+  static std::vector<ChunkOffset> scan(const AbstractSegment& segment, const ScanType scan_type,
+                                       const int32_t search_value) {
+    auto matches = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      const auto variant_value = segment[chunk_offset];
+      if (variant_is_null(variant_value)) {
+        continue;
+      }
+      const auto value = boost::get<int32_t>(variant_value);
+      const auto matches_predicate = std::array<bool, 6>{value == search_value, value != search_value,
+                                                         value < search_value,  value <= search_value,
+                                                         value > search_value,  value >= search_value};
+      if (matches_predicate[static_cast<size_t>(scan_type)]) {
+        matches.push_back(chunk_offset);
+      }
+    }
+    return matches;
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> ascending_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  std::shared_ptr<ValueSegment<int32_t>> descending_segment = std::make_shared<ValueSegment<int32_t>>(true);
+};
+
+TEST_F(StorageSortedSegmentSearchTest, DetectSortMode) {
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength}) {
+    EXPECT_EQ(detect_sort_mode<int32_t>(*encode_segment(ascending_segment, DataType::Int, {encoding_type})),
+              SortMode::Ascending);
+    EXPECT_EQ(detect_sort_mode<int32_t>(*encode_segment(descending_segment, DataType::Int, {encoding_type})),
+              SortMode::Descending);
+  }
+
+  // NULLs have to come first.
+  ascending_segment->append(NULL_VALUE);
+  EXPECT_EQ(detect_sort_mode<int32_t>(*ascending_segment), std::nullopt);
+  descending_segment->append(10);
+  EXPECT_EQ(detect_sort_mode<int32_t>(*descending_segment), std::nullopt);
+
+  auto string_segment = ValueSegment<std::string>{};
+  EXPECT_EQ(detect_sort_mode<std::string>(string_segment), SortMode::Ascending);
+  string_segment.append("b");
+  string_segment.append("b");
+  EXPECT_EQ(detect_sort_mode<std::string>(string_segment), SortMode::Ascending);
+  string_segment.append("a");
+  EXPECT_EQ(detect_sort_mode<std::string>(string_segment), SortMode::Descending);
+}
+
+TEST_F(StorageSortedSegmentSearchTest, SearchMatchesScan) {
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
+                                   EncodingType::FrameOfReference}) {
+    for (const auto sort_mode : {SortMode::Ascending, SortMode::Descending}) {
+      const auto& value_segment = sort_mode == SortMode::Ascending ? ascending_segment : descending_segment;
+      const auto segment = encode_segment(value_segment, DataType::Int, {encoding_type});
+      for (const auto scan_type :
+           {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+            ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+        for (const auto search_value : {-1, 0, 4, 9, 10}) {
+          EXPECT_EQ(search(*segment, sort_mode, scan_type, search_value), scan(*segment, scan_type, search_value))
+              << encoding_type << " " << static_cast<int>(scan_type) << " " << search_value;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(StorageSortedSegmentSearchTest, SearchStrings) {
+  auto segment = ValueSegment<std::string>{};
+  for (const auto* value : {"apple", "banana", "banana", "cherry"}) {
+    segment.append(value);
+  }
+  auto ranges = std::vector<std::pair<ChunkOffset, ChunkOffset>>{};
+  const auto search_value = std::string{"banana"};
+  sorted_segment_search<std::string>(segment, SortMode::Ascending, ScanType::OpNotEquals, search_value,
+                                     [&](const auto begin, const auto end) { ranges.emplace_back(begin, end); });
+  EXPECT_EQ(ranges, (std::vector<std::pair<ChunkOffset, ChunkOffset>>{{0, 1}, {3, 4}}));
+}
+
+}  // namespace opossum
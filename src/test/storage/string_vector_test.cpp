@@ -0,0 +1,94 @@
+#include "base_test.hpp"
+
+#include "storage/string_vector.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageStringVectorTest : public BaseTest {
+ protected:
+  StringVector string_vector{std::vector<std::string>{"Alpha", "", "Gamma"}};
+};
+
+TEST_F(StorageStringVectorTest, PushBackAndAccess) {
+  EXPECT_EQ(string_vector.size(), 3);
+  EXPECT_EQ(string_vector[0], "Alpha");
+  EXPECT_EQ(string_vector[1], "");
+  EXPECT_EQ(string_vector[2], "Gamma");
+
+  string_vector.push_back("A longer value that would not fit into a short string");
+  EXPECT_EQ(string_vector.size(), 4);
+  EXPECT_EQ(string_vector[3], "A longer value that would not fit into a short string");
+  EXPECT_EQ(string_vector[0], "Alpha");
+
+  EXPECT_TRUE(StringVector{}.empty());
+}
+
+TEST_F(StorageStringVectorTest, Iterator) {
+  const auto values = std::vector<std::string>(string_vector.begin(), string_vector.end());
+  EXPECT_EQ(values, (std::vector<std::string>{"Alpha", "", "Gamma"}));
+  EXPECT_EQ(string_vector.end() - string_vector.begin(), 3);
+  EXPECT_EQ(*(string_vector.begin() + 2), "Gamma");
+}
+
+TEST_F(StorageStringVectorTest, LongValuesAndCopies) {
+  // The values span several pages of the arena, the last one exceeds even the largest page.
+  auto long_values = std::vector<std::string>{};
+  for (auto index = 0; index < 2'000; ++index) {
+    long_values.push_back(std::string(13 + index % 50, static_cast<char>('a' + index % 26)));
+    string_vector.push_back(long_values.back());
+  }
+  long_values.push_back(std::string(3'000'000, 'z'));
+  string_vector.push_back(long_values.back());
+
+  const auto copy = string_vector;
+  for (auto index = size_t{0}; index < long_values.size(); ++index) {
+    EXPECT_FALSE(string_vector.german_string(index + 3).is_inlined());
+    EXPECT_EQ(string_vector[index + 3], long_values[index]);
+    EXPECT_EQ(copy[index + 3], long_values[index]);
+    EXPECT_NE(copy[index + 3].data(), string_vector[index + 3].data());
+  }
+  EXPECT_TRUE(string_vector.german_string(0).is_inlined());
+}
+
+TEST_F(StorageStringVectorTest, Move) {
+  const auto long_value = std::string(20, 'l');
+  string_vector.push_back(long_value);
+  const auto* const address = string_vector[3].data();
+
+  // The moved values keep their addresses in the arena. The moved-from vector is empty and allocates a page of its own.
+  auto moved = std::move(string_vector);
+  EXPECT_EQ(moved.size(), 4);
+  EXPECT_EQ(moved[3].data(), address);
+  EXPECT_TRUE(string_vector.empty());  // NOLINT(bugprone-use-after-move)
+  string_vector.push_back(long_value);
+  EXPECT_EQ(string_vector[0], long_value);
+  EXPECT_NE(string_vector[0].data(), address);
+
+  auto assigned = StringVector{};
+  assigned = std::move(moved);
+  moved.push_back(long_value);  // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(assigned[3], long_value);
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_NE(moved[0].data(), address);
+}
+
+TEST_F(StorageStringVectorTest, MemoryUsage) {
+  auto value_segment = ValueSegment<std::string>{};
+  for (auto index = 0; index < 1'000; ++index) {
+    value_segment.append(std::string(100, 'x'));
+  }
+
+  // The string bytes are counted, not only the fixed size per value.
+  EXPECT_GE(value_segment.estimate_memory_usage(), 1'000 * 100);
+  EXPECT_LT(value_segment.estimate_memory_usage(), 1'000 * (100 + sizeof(GermanString)) * 2);
+
+  // Short values are inlined and need no memory besides their GermanString.
+  auto short_value_segment = ValueSegment<std::string>{};
+  for (auto index = 0; index < 1'000; ++index) {
+    short_value_segment.append(std::string(12, 'x'));
+  }
+  EXPECT_LT(short_value_segment.estimate_memory_usage(), 1'000 * sizeof(GermanString) * 2);
+}
+
+}  // namespace opossum
@@ -1,6 +1,13 @@
 #include "base_test.hpp"
 
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/b_plus_tree_index.hpp"
+#include "storage/index/group_key_index.hpp"
 #include "storage/table.hpp"
+#include "storage/zone_map.hpp"
+#include "utils/load_table.hpp"
 
 namespace opossum {
 
@@ -60,6 +67,8 @@ TEST_F(StorageTableTest, GetColumnType) {
   EXPECT_EQ(table.column_type(ColumnID{0}), "int");
   EXPECT_EQ(table.column_type(ColumnID{1}), "string");
   EXPECT_THROW(table.column_type(ColumnID{7}), std::logic_error);
+  EXPECT_EQ(table.column_data_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(table.column_data_type(ColumnID{1}), DataType::String);
 }
 
 TEST_F(StorageTableTest, ColumnNullable) {
@@ -110,4 +119,337 @@ TEST_F(StorageTableTest, AppendWithEncodedSegments) {
   EXPECT_EQ(table.chunk_count(), 2);
 }
 
+TEST_F(StorageTableTest, ColumnEncodings) {
+  EXPECT_EQ(table.column_encoding(ColumnID{0}), SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_THROW(table.set_column_encoding(ColumnID{1}, {EncodingType::FrameOfReference}), std::logic_error);
+
+  table.set_column_encoding(ColumnID{0}, {EncodingType::RunLength});
+  table.set_column_encoding(ColumnID{1}, {EncodingType::Auto});
+  EXPECT_EQ(table.column_encoding(ColumnID{1}), SegmentEncodingSpec{EncodingType::Auto});
+  table.append({1, "foo"});
+  table.append({1, "foo"});
+
+  const auto chosen_encodings = table.compress_chunk(ChunkID{0});
+  ASSERT_EQ(chosen_encodings.size(), 2);
+  EXPECT_EQ(chosen_encodings[0], SegmentEncodingSpec{EncodingType::RunLength});
+  EXPECT_NE(chosen_encodings[1].encoding_type, EncodingType::Auto);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{0})), chosen_encodings[0]);
+  EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{1})), chosen_encodings[1]);
+  EXPECT_EQ(chunk->get_segment(ColumnID{1})->operator[](1), AllTypeVariant{"foo"});
+}
+
+TEST_F(StorageTableTest, SharedDictionaries) {
+  EXPECT_THROW(table.set_column_encoding(ColumnID{0}, {EncodingType::RunLength, {}, false, true}), std::logic_error);
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    table.set_column_encoding(column_id, {EncodingType::Dictionary, VectorCompressionType::BitPacked, false, true});
+  }
+
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  table.append({6, NULL_VALUE});
+  table.append({8, "!"});
+  table.append({4, "world"});
+  table.append({6, "Hello,"});
+  const auto chosen_encodings = table.compress_chunk(ChunkID{0});
+  EXPECT_TRUE(chosen_encodings[1].use_shared_dictionary);
+  const auto chunk_0 = table.get_chunk(ChunkID{0});
+
+  // The second chunk adds new values, so the first one is re-encoded. The third one only contains known values.
+  table.compress_chunk(ChunkID{1});
+  EXPECT_NE(table.get_chunk(ChunkID{0}), chunk_0);
+  const auto chunk_1 = table.get_chunk(ChunkID{1});
+  table.compress_chunk(ChunkID{2});
+  EXPECT_EQ(table.get_chunk(ChunkID{1}), chunk_1);
+
+  const auto segment = [&](const ChunkID chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    return std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1}));
+  };
+  EXPECT_EQ(segment(ChunkID{0})->shared_dictionary(), segment(ChunkID{2})->shared_dictionary());
+  EXPECT_EQ(segment(ChunkID{0})->dictionary().values(), std::vector<std::string>({"!", "Hello,", "world"}));
+  EXPECT_EQ(get_segment_encoding_spec(segment(ChunkID{0})), chosen_encodings[1]);
+
+  // Equal values have equal value ids in all chunks.
+  EXPECT_EQ(segment(ChunkID{0})->attribute_vector()->get(0), segment(ChunkID{2})->attribute_vector()->get(1));
+  EXPECT_EQ(segment(ChunkID{0})->attribute_vector()->get(1), segment(ChunkID{2})->attribute_vector()->get(0));
+  EXPECT_EQ(segment(ChunkID{1})->attribute_vector()->get(0), segment(ChunkID{1})->null_value_id());
+
+  EXPECT_EQ((*segment(ChunkID{0}))[1], AllTypeVariant{"world"});
+  EXPECT_EQ((*segment(ChunkID{1}))[1], AllTypeVariant{"!"});
+  EXPECT_EQ((*table.get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[0], AllTypeVariant{4});
+  EXPECT_EQ((*table.get_chunk(ChunkID{2})->get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+}
+
+TEST_F(StorageTableTest, PendingSharedDictionaries) {
+  auto shared_table = Table{8};
+  shared_table.add_column("col_1", DataType::Int, false);
+  shared_table.set_column_encoding(ColumnID{0}, {EncodingType::Dictionary, {}, false, true});
+  for (auto chunk_index = 0; chunk_index < 5; ++chunk_index) {
+    for (auto value = 0; value < 7; ++value) {
+      shared_table.append({value});
+    }
+    shared_table.append({chunk_index == 0 ? 7 : 99 + chunk_index});
+  }
+  const auto segment = [&](const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+        shared_table.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+  };
+  shared_table.compress_chunk(ChunkID{0});
+  const auto first_chunk = shared_table.get_chunk(ChunkID{0});
+
+  // Each chunk adds one value to the eight of the shared dictionary. The first two stay pending, and the other chunks
+  // are not re-encoded.
+  shared_table.compress_chunk(ChunkID{1});
+  shared_table.compress_chunk(ChunkID{2});
+  EXPECT_EQ(shared_table.get_chunk(ChunkID{0}), first_chunk);
+  EXPECT_TRUE(segment(ChunkID{0})->has_shared_dictionary());
+  EXPECT_FALSE(segment(ChunkID{1})->has_shared_dictionary());
+  EXPECT_FALSE(segment(ChunkID{2})->has_shared_dictionary());
+  EXPECT_EQ(segment(ChunkID{0})->unique_values_count(), 8);
+  EXPECT_EQ((*segment(ChunkID{2}))[7], AllTypeVariant{101});
+
+  // The third new value exceeds a quarter of the shared dictionary, so all chunks are encoded against the merged one.
+  shared_table.compress_chunk(ChunkID{3});
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    EXPECT_TRUE(segment(chunk_id)->has_shared_dictionary());
+    EXPECT_EQ(segment(chunk_id)->shared_dictionary(), segment(ChunkID{0})->shared_dictionary());
+    EXPECT_EQ((*segment(chunk_id))[7], AllTypeVariant{chunk_id == 0 ? 7 : 99 + static_cast<int32_t>(chunk_id)});
+  }
+  EXPECT_EQ(segment(ChunkID{0})->unique_values_count(), 11);
+  EXPECT_NE(shared_table.get_chunk(ChunkID{0}), first_chunk);
+
+  // Pending dictionaries can also be merged on request.
+  shared_table.compress_chunk(ChunkID{4});
+  EXPECT_FALSE(segment(ChunkID{4})->has_shared_dictionary());
+  shared_table.share_dictionaries();
+  EXPECT_EQ(segment(ChunkID{4})->shared_dictionary(), segment(ChunkID{0})->shared_dictionary());
+  EXPECT_EQ(segment(ChunkID{0})->unique_values_count(), 12);
+  EXPECT_EQ((*segment(ChunkID{4}))[7], AllTypeVariant{103});
+  EXPECT_EQ((*segment(ChunkID{4}))[0], AllTypeVariant{0});
+}
+
+TEST_F(StorageTableTest, ZoneMaps) {
+  // Rows are appended in time order, so a filter on recent timestamps only has to scan the last chunk.
+  auto time_ordered_table = Table{3};
+  time_ordered_table.add_column("time", DataType::Timestamp, false);
+  for (auto second = int64_t{0}; second < 10; ++second) {
+    time_ordered_table.append({Timestamp{second * 1'000'000}});
+  }
+  time_ordered_table.compress_chunk(ChunkID{0});
+  time_ordered_table.compress_chunk(ChunkID{1});
+
+  const auto search_value = AllTypeVariant{Timestamp{7'500'000}};
+  auto scanned_chunks = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < time_ordered_table.chunk_count(); ++chunk_id) {
+    if (!time_ordered_table.get_chunk(chunk_id)->can_prune(ColumnID{0}, ScanType::OpGreaterThan, search_value)) {
+      scanned_chunks.push_back(chunk_id);
+    }
+  }
+  EXPECT_EQ(scanned_chunks, std::vector<ChunkID>({ChunkID{2}, ChunkID{3}}));
+
+  // The zone map of the last chunk is maintained on append.
+  const auto last_chunk = time_ordered_table.get_chunk(ChunkID{3});
+  EXPECT_EQ(last_chunk->get_zone_map(ColumnID{0})->max(), AllTypeVariant{Timestamp{9'000'000}});
+  EXPECT_TRUE(last_chunk->can_prune(ColumnID{0}, ScanType::OpGreaterThan, AllTypeVariant{Timestamp{9'000'000}}));
+  time_ordered_table.append({Timestamp{9'500'000}});
+  EXPECT_FALSE(last_chunk->can_prune(ColumnID{0}, ScanType::OpGreaterThan, AllTypeVariant{Timestamp{9'000'000}}));
+
+  // Compressing a chunk keeps its zone maps, and shared dictionaries are re-encoded without changing them.
+  table.set_column_encoding(ColumnID{1}, {EncodingType::Dictionary, {}, false, true});
+  table.append({4, "b"});
+  table.append({6, NULL_VALUE});
+  table.append({8, "a"});
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1});
+  const auto first_chunk = table.get_chunk(ChunkID{0});
+  EXPECT_EQ(first_chunk->get_zone_map(ColumnID{0})->min(), AllTypeVariant{4});
+  EXPECT_EQ(first_chunk->get_zone_map(ColumnID{1})->max(), AllTypeVariant{"b"});
+  EXPECT_EQ(first_chunk->get_zone_map(ColumnID{1})->null_count(), 1);
+  EXPECT_TRUE(first_chunk->can_prune(ColumnID{1}, ScanType::OpEquals, AllTypeVariant{"a"}));
+}
+
+TEST_F(StorageTableTest, BloomFilters) {
+  // The keys of all chunks cover the same range, so only the Bloom filters can prune chunks for equality predicates.
+  auto key_table = Table{4};
+  key_table.add_column("key", DataType::Int, false);
+  key_table.set_column_bloom_filter(ColumnID{0}, true);
+  EXPECT_TRUE(key_table.column_bloom_filter(ColumnID{0}));
+  for (const auto key : {1, 5, 9, 13, 2, 6, 10, 14, 3, 11, 4, 12}) {
+    key_table.append({key});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < key_table.chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(key_table.get_chunk(chunk_id)->get_bloom_filter(ColumnID{0}));
+    key_table.compress_chunk(chunk_id);
+  }
+
+  auto scanned_chunks = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < key_table.chunk_count(); ++chunk_id) {
+    const auto chunk = key_table.get_chunk(chunk_id);
+    ASSERT_TRUE(chunk->get_bloom_filter(ColumnID{0}));
+    EXPECT_FALSE(chunk->get_zone_map(ColumnID{0})->can_prune(ScanType::OpEquals, 10));
+    if (!chunk->can_prune(ColumnID{0}, ScanType::OpEquals, 10)) {
+      scanned_chunks.push_back(chunk_id);
+    }
+    // Bloom filters only help for equality predicates.
+    EXPECT_FALSE(chunk->can_prune(ColumnID{0}, ScanType::OpNotEquals, 10));
+  }
+  EXPECT_EQ(scanned_chunks, std::vector<ChunkID>({ChunkID{1}}));
+
+  EXPECT_FALSE(table.column_bloom_filter(ColumnID{1}));
+  table.append({1, "foo"});
+  table.compress_chunk(ChunkID{0});
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->get_bloom_filter(ColumnID{1}));
+}
+
+TEST_F(StorageTableTest, Indexes) {
+  EXPECT_EQ(table.column_index_type(ColumnID{1}), std::nullopt);
+  table.set_column_index_type(ColumnID{1}, IndexType::GroupKey);
+  EXPECT_EQ(table.column_index_type(ColumnID{1}), IndexType::GroupKey);
+  table.set_column_encoding(ColumnID{1}, {EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger, false,
+                                          true});
+  table.append({1, "b"});
+  table.append({2, "a"});
+  table.append({3, "b"});
+  table.append({4, "c"});
+
+  table.compress_chunk(ChunkID{0});
+  const auto index_0 = table.get_chunk(ChunkID{0})->get_index(ColumnID{1});
+  ASSERT_TRUE(index_0);
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->get_index(ColumnID{0}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{1})->get_index(ColumnID{1}));
+
+  // Compressing the second chunk extends the shared dictionary, so the first chunk is re-encoded and indexed again.
+  table.set_column_index_type(ColumnID{0}, IndexType::Imprint);
+  table.compress_chunk(ChunkID{1});
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->get_index(ColumnID{0}));
+  EXPECT_TRUE(table.get_chunk(ChunkID{1})->get_index(ColumnID{0}));
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto index = table.get_chunk(chunk_id)->get_index(ColumnID{1});
+    ASSERT_TRUE(index);
+    auto matches = PosList{};
+    index->append_matches(ScanType::OpEquals, "b", chunk_id, matches);
+    EXPECT_EQ(matches.size(), 1);
+  }
+  EXPECT_NE(table.get_chunk(ChunkID{0})->get_index(ColumnID{1}), index_0);
+
+  // Indexes are only built for DictionarySegments.
+  table.set_column_encoding(ColumnID{1}, {EncodingType::RunLength});
+  table.append({5, "d"});
+  table.compress_chunk(ChunkID{2});
+  EXPECT_FALSE(table.get_chunk(ChunkID{2})->get_index(ColumnID{1}));
+}
+
+TEST_F(StorageTableTest, BPlusTreeIndexes) {
+  // The index is attached to the open chunk right away and maintained while rows are appended.
+  table.append({4, "a"});
+  table.set_column_index_type(ColumnID{0}, IndexType::BPlusTree);
+  table.append({2, "b"});
+  table.append({4, "c"});
+  const auto lookup = [&](const ChunkID chunk_id) {
+    auto matches = PosList{};
+    table.get_chunk(chunk_id)->get_index(ColumnID{0})->append_matches(ScanType::OpEquals, 4, chunk_id, matches);
+    return matches;
+  };
+  EXPECT_EQ(lookup(ChunkID{0}), PosList({RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_EQ(lookup(ChunkID{1}), PosList({RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{1})->get_index(ColumnID{1}));
+
+  // Compressed chunks are indexed as well.
+  table.compress_chunk(ChunkID{1});
+  EXPECT_EQ(lookup(ChunkID{1}), PosList({RowID{ChunkID{1}, ChunkOffset{0}}}));
+
+  table.set_column_index_type(ColumnID{0}, std::nullopt);
+  table.append({4, "d"});
+  EXPECT_TRUE(table.get_chunk(ChunkID{1})->get_index(ColumnID{0}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{2})->get_index(ColumnID{0}));
+}
+
+TEST_F(StorageTableTest, CrackingIndexes) {
+  const auto lookup = [&](const ChunkID chunk_id) {
+    auto matches = PosList{};
+    table.get_chunk(chunk_id)->get_index(ColumnID{0})->append_matches(ScanType::OpEquals, 4, chunk_id, matches);
+    return matches;
+  };
+
+  // Cracking indexes cannot be maintained on append, so open chunks do not get one, and only compressed chunks do.
+  table.set_column_index_type(ColumnID{0}, IndexType::Cracking);
+  table.append({4, "a"});
+  table.append({2, "b"});
+  table.append({4, "c"});
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->get_index(ColumnID{0}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{1})->get_index(ColumnID{0}));
+  table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(lookup(ChunkID{0}), PosList({RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{1})->get_index(ColumnID{0}));
+
+  // Switching from a B+-tree to cracking drops the index of the open chunk.
+  table.set_column_index_type(ColumnID{0}, IndexType::BPlusTree);
+  EXPECT_EQ(lookup(ChunkID{1}), PosList({RowID{ChunkID{1}, ChunkOffset{0}}}));
+  table.set_column_index_type(ColumnID{0}, IndexType::Cracking);
+  EXPECT_FALSE(table.get_chunk(ChunkID{1})->get_index(ColumnID{0}));
+
+  table.append({4, "d"});
+  table.compress_chunk(ChunkID{1});
+  EXPECT_EQ(lookup(ChunkID{1}), PosList({RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{1}}}));
+  EXPECT_TRUE(table.get_chunk(ChunkID{0})->get_index(ColumnID{0}));
+}
+
+TEST_F(StorageTableTest, SortedChunks) {
+  const auto expected_sorted_by = std::vector<SortColumnDefinition>{{ColumnID{0}, SortMode::Ascending}};
+  table.set_sorted_by(expected_sorted_by);
+  EXPECT_EQ(table.sorted_by(), expected_sorted_by);
+  table.append({1, "b"});
+  EXPECT_THROW(table.set_sorted_by({}), std::logic_error);
+  table.append({2, "a"});
+  table.append({3, NULL_VALUE});
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->individually_sorted_by(), expected_sorted_by);
+  EXPECT_EQ(table.get_chunk(ChunkID{1})->sort_mode(ColumnID{0}), SortMode::Ascending);
+  EXPECT_EQ(table.get_chunk(ChunkID{1})->sort_mode(ColumnID{1}), std::nullopt);
+
+  // The declared order is dropped when an appended row breaks it.
+  table.append({0, "c"});
+  EXPECT_EQ(table.get_chunk(ChunkID{1})->sort_mode(ColumnID{0}), std::nullopt);
+
+  // Compressed chunks are sorted by all columns whose values are in order, even if this was not declared. NULLs come
+  // first.
+  table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->sort_mode(ColumnID{0}), SortMode::Ascending);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->sort_mode(ColumnID{1}), SortMode::Descending);
+  table.compress_chunk(ChunkID{1});
+  const auto expected_detected_sorted_by = std::vector<SortColumnDefinition>{{ColumnID{0}, SortMode::Descending},
+                                                                             {ColumnID{1}, SortMode::Ascending}};
+  EXPECT_EQ(table.get_chunk(ChunkID{1})->individually_sorted_by(), expected_detected_sorted_by);
+}
+
+TEST_F(StorageTableTest, CompactDataTypes) {
+  const auto loaded_table = load_table("src/test/tables/compact_types.tbl", 3);
+  EXPECT_EQ(loaded_table->column_type(ColumnID{2}), "date");
+
+  const auto date = Date::from_year_month_day(2023, 1, 31);
+  const auto morning = Timestamp{Timestamp::from_date(date).microseconds_since_epoch() + 29'700'000'000};
+  const auto new_year = Timestamp{Timestamp::from_date(Date{10'957}).microseconds_since_epoch() - 500'000};
+  const auto expected_rows = std::vector<std::vector<AllTypeVariant>>{
+      {int8_t{-5}, int16_t{1000}, date, morning, Decimal::from_unscaled(199'900)},
+      {int8_t{7}, int16_t{-1000}, Date{10'956}, new_year, Decimal::from_unscaled(-100)},
+      {int8_t{7}, int16_t{32767}, date, Timestamp::from_date(date), Decimal::from_unscaled(10'000'000'000)}};
+
+  for (const auto encoding_type :
+       {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength, EncodingType::Auto}) {
+    const auto table = load_table("src/test/tables/compact_types.tbl", 3);
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      table->set_column_encoding(column_id, {encoding_type});
+    }
+    table->compress_chunk(ChunkID{0});
+
+    const auto chunk = table->get_chunk(ChunkID{0});
+    for (auto row = ChunkOffset{0}; row < expected_rows.size(); ++row) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        EXPECT_EQ((*chunk->get_segment(column_id))[row], expected_rows[row][column_id]);
+      }
+    }
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,111 @@
+#include "base_test.hpp"
+
+#include "storage/validity_bitmap.hpp"
+
+namespace opossum {
+
+class StorageValidityBitmapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Every third row of 150 is NULL, i.e., the rows span three words, the last one partially.
+    for (auto index = size_t{0}; index < 150; ++index) {
+      bitmap.push_back(index % 3 != 0);
+    }
+  }
+
+  ValidityBitmap bitmap;
+};
+
+TEST_F(StorageValidityBitmapTest, PushBackAndAccess) {
+  EXPECT_EQ(bitmap.size(), 150);
+  EXPECT_EQ(bitmap.words().size(), 3);
+  EXPECT_TRUE(bitmap.is_null(0));
+  EXPECT_TRUE(bitmap.is_valid(1));
+  EXPECT_TRUE(bitmap.is_null(129));
+  EXPECT_EQ(bitmap.null_count(), 50);
+  EXPECT_EQ(bitmap.valid_count(), 100);
+  EXPECT_FALSE(bitmap.all_valid());
+
+  bitmap.set_valid(0, true);
+  bitmap.set_valid(0, true);
+  bitmap.set_valid(1, false);
+  EXPECT_TRUE(bitmap.is_valid(0));
+  EXPECT_TRUE(bitmap.is_null(1));
+  EXPECT_EQ(bitmap.null_count(), 50);
+  EXPECT_THROW(bitmap.set_valid(150, true), std::logic_error);
+}
+
+TEST_F(StorageValidityBitmapTest, AllValid) {
+  const auto all_valid = ValidityBitmap{70};
+  EXPECT_TRUE(all_valid.all_valid());
+  EXPECT_EQ(all_valid.valid_count(), 70);
+  // Bits beyond the size are cleared.
+  EXPECT_EQ(all_valid.words().back(), uint64_t{0b111111});
+
+  const auto all_null = ValidityBitmap{70, false};
+  EXPECT_EQ(all_null.null_count(), 70);
+  EXPECT_TRUE(ValidityBitmap{}.all_valid());
+}
+
+TEST_F(StorageValidityBitmapTest, CountValid) {
+  EXPECT_EQ(bitmap.count_valid(0, 150), 100);
+  EXPECT_EQ(bitmap.count_valid(0, 0), 0);
+  EXPECT_EQ(bitmap.count_valid(1, 3), 2);
+  EXPECT_EQ(bitmap.count_valid(60, 130), 46);
+  EXPECT_THROW(bitmap.count_valid(10, 151), std::logic_error);
+}
+
+TEST_F(StorageValidityBitmapTest, ForEachValid) {
+  auto indices = std::vector<size_t>{};
+  bitmap.for_each_valid(62, 70, [&](const size_t index) { indices.push_back(index); });
+  EXPECT_EQ(indices, (std::vector<size_t>{62, 64, 65, 67, 68}));
+
+  auto count = size_t{0};
+  bitmap.for_each_valid(0, 150, [&](const size_t index) {
+    EXPECT_TRUE(bitmap.is_valid(index));
+    ++count;
+  });
+  EXPECT_EQ(count, 100);
+}
+
+TEST_F(StorageValidityBitmapTest, CombineWordWise) {
+  auto other = ValidityBitmap{150};
+  for (auto index = size_t{0}; index < 150; index += 2) {
+    other.set_valid(index, false);
+  }
+
+  const auto both_valid = bitmap & other;
+  const auto any_valid = bitmap | other;
+  for (auto index = size_t{0}; index < 150; ++index) {
+    EXPECT_EQ(both_valid.is_valid(index), index % 3 != 0 && index % 2 != 0);
+    EXPECT_EQ(any_valid.is_valid(index), index % 3 != 0 || index % 2 != 0);
+  }
+  EXPECT_EQ(both_valid.valid_count(), 50);
+  EXPECT_EQ(any_valid.null_count(), 25);
+  EXPECT_THROW(bitmap &= ValidityBitmap{10}, std::logic_error);
+}
+
+TEST_F(StorageValidityBitmapTest, AssignRange) {
+  auto range = ValidityBitmap{};
+  for (const auto& [begin, end] : std::vector<std::pair<size_t, size_t>>{{0, 150}, {1, 130}, {64, 128}, {70, 71}}) {
+    range.assign(bitmap, begin, end);
+    EXPECT_EQ(range.size(), end - begin);
+    EXPECT_EQ(range.valid_count(), bitmap.count_valid(begin, end));
+    for (auto index = begin; index < end; ++index) {
+      EXPECT_EQ(range.is_valid(index - begin), bitmap.is_valid(index));
+    }
+  }
+
+  // Unused bits of the last word are cleared, so that whole words can be counted.
+  range.assign(bitmap, 2, 4);
+  EXPECT_EQ(range.words(), std::vector<uint64_t>({0b01}));
+  EXPECT_THROW(range.assign(bitmap, 100, 151), std::logic_error);
+
+  range.assign(70, false);
+  EXPECT_EQ(range.null_count(), 70);
+  range.assign(3, true);
+  EXPECT_EQ(range.words(), std::vector<uint64_t>({0b111}));
+  EXPECT_TRUE(range.all_valid());
+}
+
+}  // namespace opossum
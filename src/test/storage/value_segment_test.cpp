@@ -88,7 +88,12 @@ TEST_F(StorageValueSegmentTest, GetValues) {
   EXPECT_EQ(int_value_segment.values(), (std::vector<int>{1, 2}));
   double_value_segment.append(0.0);
   EXPECT_EQ(double_value_segment.values(), (std::vector<double>{0.0}));
-  EXPECT_EQ(string_value_segment.values(), (std::vector<std::string>{}));
+  EXPECT_TRUE(string_value_segment.values().empty());
+  string_value_segment.append("Hello");
+  string_value_segment.append("");
+  EXPECT_EQ(string_value_segment.values().size(), 2);
+  EXPECT_EQ(string_value_segment.values()[0], "Hello");
+  EXPECT_EQ(string_value_segment.values()[1], "");
 }
 
 TEST_F(StorageValueSegmentTest, IndexingOperator) {
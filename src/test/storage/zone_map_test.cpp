@@ -0,0 +1,106 @@
+#include "base_test.hpp"
+
+#include <limits>
+
+#include "storage/segment_encoding.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {5, 9, 7, 3}) {
+      int_segment->append(value);
+    }
+    int_segment->append(NULL_VALUE);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> int_segment = std::make_shared<ValueSegment<int32_t>>(true);
+};
+
+TEST_F(StorageZoneMapTest, CreateFromSegment) {
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
+                                   EncodingType::FrameOfReference}) {
+    const auto segment = encode_segment(int_segment, DataType::Int, {encoding_type});
+    const auto zone_map = ZoneMap<int32_t>{*segment};
+    EXPECT_EQ(zone_map.min(), AllTypeVariant{3});
+    EXPECT_EQ(zone_map.max(), AllTypeVariant{9});
+    EXPECT_EQ(zone_map.null_count(), 1);
+  }
+}
+
+TEST_F(StorageZoneMapTest, CanPrune) {
+  const auto zone_map = ZoneMap<int32_t>{*int_segment};
+
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpEquals, 2));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, 3));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, 4));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, 9));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpEquals, 10));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpNotEquals, 3));
+
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpLessThan, 3));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpLessThan, 4));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpLessThanEquals, 2));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpLessThanEquals, 3));
+
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpGreaterThan, 9));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpGreaterThan, 8));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpGreaterThanEquals, 10));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpGreaterThanEquals, 9));
+
+  // NULL search values and search values of another data type are not pruned on.
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, NULL_VALUE));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, int64_t{20}));
+}
+
+TEST_F(StorageZoneMapTest, Append) {
+  auto zone_map = ZoneMap<std::string>{};
+  EXPECT_TRUE(variant_is_null(zone_map.min()));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpNotEquals, "a"));
+
+  zone_map.append(NULL_VALUE);
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpGreaterThanEquals, ""));
+  EXPECT_EQ(zone_map.null_count(), 1);
+
+  zone_map.append("b");
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpNotEquals, "b"));
+  zone_map.append("d");
+  zone_map.append("c");
+  EXPECT_EQ(zone_map.min(), AllTypeVariant{"b"});
+  EXPECT_EQ(zone_map.max(), AllTypeVariant{"d"});
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpNotEquals, "b"));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpLessThan, "b"));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpEquals, "e"));
+}
+
+TEST_F(StorageZoneMapTest, IgnoreNaN) {
+  constexpr auto NAN_VALUE = std::numeric_limits<float>::quiet_NaN();
+  auto zone_map = ZoneMap<float>{};
+  zone_map.append(NAN_VALUE);
+  EXPECT_TRUE(variant_is_null(zone_map.min()));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpEquals, 1.0f));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpNotEquals, 1.0f));
+
+  // A leading NaN must not prevent later values from extending the range.
+  zone_map.append(2.0f);
+  zone_map.append(-1.0f);
+  zone_map.append(NAN_VALUE);
+  zone_map.append(4.0f);
+  EXPECT_EQ(zone_map.min(), AllTypeVariant{-1.0f});
+  EXPECT_EQ(zone_map.max(), AllTypeVariant{4.0f});
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, 3.0f));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpGreaterThan, 4.0f));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpLessThan, -1.0f));
+
+  const auto segment = std::make_shared<ValueSegment<float>>(std::vector<float>{NAN_VALUE, 3.0f, NAN_VALUE, 1.0f});
+  const auto segment_zone_map = ZoneMap<float>{*segment};
+  EXPECT_EQ(segment_zone_map.min(), AllTypeVariant{1.0f});
+  EXPECT_EQ(segment_zone_map.max(), AllTypeVariant{3.0f});
+  EXPECT_TRUE(segment_zone_map.can_prune(ScanType::OpEquals, 5.0f));
+  EXPECT_FALSE(segment_zone_map.can_prune(ScanType::OpNotEquals, 1.0f));
+}
+
+}  // namespace opossum